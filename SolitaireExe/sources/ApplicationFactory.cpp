@@ -5,10 +5,12 @@
 #include "ApplicationFactory.h"
 #include "Button.h"
 #include "Context.h"
+#include "GameState.h"
 #include "Layout.h"
 #include "Solitaire.h"
 #include "archivers/HistoryTracker.h"
 #include "archivers/MoveCardsOperationSnapshotCreator.h"
+#include "archivers/SnapshotsPool.h"
 #include "cards/ShuffledDeckGenerator.h"
 #include "colliders/FoundationPileCollider.h"
 #include "colliders/StockPileCollider.h"
@@ -22,6 +24,7 @@
 #include "piles/TableauPile.h"
 #include "piles/PileId.h"
 #include "SDL/Wrapper.h"
+#include "solvers/HintEngine.h"
 #include "time/ChronoFPSLimiter.h"
 #include "time/StdTimeFunctionsWrapper.h"
 
@@ -32,8 +35,13 @@ using namespace solitaire::colliders;
 using namespace solitaire::events;
 using namespace solitaire::graphics;
 using namespace solitaire::piles;
+using namespace solitaire::solvers;
 using namespace solitaire::time;
 
+namespace {
+constexpr std::size_t maxTransientSnapshotsCount {2 * GameState::pilesCount};
+}
+
 Application ApplicationFactory::make() const {
     auto context = makeContext();
     auto eventsProcessor = makeEventsProcessor(*context);
@@ -69,27 +77,33 @@ ApplicationFactory::makeContext() const
         ),
         std::make_unique<Button>(
             Layout::undoButtonPosition, Layout::undoButtonSize
-        )
+        ),
+        std::make_unique<HintEngine>()
     );
 }
 
 std::unique_ptr<solitaire::interfaces::Solitaire>
 ApplicationFactory::makeSolitaire() const
 {
+    const auto snapshotsPool = std::make_shared<SnapshotsPool>(
+        SnapshotsPool::getBlocksCountForMemoryLimit(HistoryTracker::defaultMemoryLimit / 2),
+        SnapshotsPool::getBlocksCountForMemoryLimit(HistoryTracker::defaultMemoryLimit) +
+            maxTransientSnapshotsCount);
+
     Solitaire::FoundationPiles foundationPiles;
     for (auto& pile: foundationPiles)
-        pile = std::make_shared<FoundationPile>();
+        pile = std::make_shared<FoundationPile>(snapshotsPool);
 
     Solitaire::TableauPiles tableauPiles;
     for (auto& pile: tableauPiles)
-        pile = std::make_shared<TableauPile>();
+        pile = std::make_shared<TableauPile>(snapshotsPool);
 
     return std::make_unique<Solitaire>(
         std::make_unique<ShuffledDeckGenerator>(),
-        std::make_shared<StockPile>(),
+        std::make_shared<StockPile>(snapshotsPool),
         foundationPiles, tableauPiles,
         std::make_unique<HistoryTracker>(),
-        std::make_unique<MoveCardsOperationSnapshotCreator>()
+        std::make_unique<MoveCardsOperationSnapshotCreator>(snapshotsPool)
     );
 }
 
@@ -23,7 +23,8 @@ public:
             FoundationPileColliders, TableauPileColliders,
             std::unique_ptr<colliders::interfaces::StockPileCollider>,
             std::unique_ptr<interfaces::Button>,
-            std::unique_ptr<interfaces::Button>);
+            std::unique_ptr<interfaces::Button>,
+            std::unique_ptr<solvers::interfaces::HintEngine>);
 
     void setMousePosition(const geometry::Position&) override;
     void setCardsInHandPosition(const geometry::Position&) override;
@@ -55,6 +56,9 @@ public:
     interfaces::Button& getUndoButton() override;
     const interfaces::Button& getUndoButton() const override;
 
+    solvers::interfaces::HintEngine& getHintEngine() override;
+    const solvers::interfaces::HintEngine& getHintEngine() const override;
+
     geometry::Position getMousePosition() const override;
     geometry::Position getCardsInHandPosition() const override;
 
@@ -67,6 +71,7 @@ private:
     geometry::Position cardsInHandPosition;
     std::unique_ptr<interfaces::Button> newGameButton;
     std::unique_ptr<interfaces::Button> undoButton;
+    std::unique_ptr<solvers::interfaces::HintEngine> hintEngine;
 };
 
 }
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "cards/Card.h"
+#include "cards/Deck.h"
+#include "interfaces/Solitaire.h"
+
+namespace solitaire {
+
+struct GameState {
+    static constexpr std::uint8_t noSelectedStockPileCard {0xFF};
+    static constexpr unsigned firstFoundationPileIndex {
+        interfaces::Solitaire::tableauPilesCount};
+    static constexpr unsigned stockPileIndex {
+        firstFoundationPileIndex + interfaces::Solitaire::foundationPilesCount};
+    static constexpr unsigned pilesCount {stockPileIndex + 1};
+
+    using PilesOffsets = std::array<std::uint8_t, pilesCount + 1>;
+
+    static GameState fromDeck(const cards::Deck& deck);
+
+    PilesOffsets getPilesOffsets() const;
+    std::uint64_t getPositionHash() const;
+
+    cards::Deck cards;
+    std::array<std::uint8_t, interfaces::Solitaire::tableauPilesCount> tableauPilesSizes;
+    std::array<std::uint8_t, interfaces::Solitaire::tableauPilesCount>
+        tableauPilesTopCoveredCardPositions;
+    std::array<std::uint8_t, interfaces::Solitaire::foundationPilesCount>
+        foundationPilesSizes;
+    std::uint8_t stockPileSelectedCardIndex;
+};
+
+static_assert(std::is_trivially_copyable_v<GameState>);
+static_assert(std::has_unique_object_representations_v<GameState>);
+static_assert(sizeof(GameState) <= 128);
+
+bool operator==(const GameState& lhs, const GameState& rhs);
+bool operator!=(const GameState& lhs, const GameState& rhs);
+
+}
+
+namespace std {
+
+template <>
+struct hash<solitaire::GameState> {
+    std::size_t operator()(const solitaire::GameState& gameState) const;
+};
+
+}
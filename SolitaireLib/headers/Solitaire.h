@@ -1,12 +1,16 @@
 #pragma once
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "cards/Card.h"
 #include "cards/Deck.h"
 #include "interfaces/Solitaire.h"
+#include "interfaces/archivers/MoveRecordsHistoryTracker.h"
 
 namespace solitaire::archivers::interfaces {
+    class Archiver;
     class HistoryTracker;
     class MoveCardsOperationSnapshotCreator;
     class Snapshot;
@@ -24,11 +28,16 @@ public:
               std::shared_ptr<piles::interfaces::StockPile>,
               FoundationPiles, TableauPiles,
               std::unique_ptr<archivers::interfaces::HistoryTracker>,
-              std::unique_ptr<archivers::interfaces::MoveCardsOperationSnapshotCreator>);
+              std::unique_ptr<archivers::interfaces::MoveCardsOperationSnapshotCreator>,
+              std::unique_ptr<archivers::interfaces::MoveRecordsHistoryTracker> = nullptr);
 
     void startNewGame() override;
 
+    GameState exportGameState() const override;
+    void importGameState(const GameState&) override;
+
     void tryUndoOperation() override;
+    void tryRedoOperation() override;
     void tryPutCardsBackFromHand() override;
 
     void tryPullOutCardFromFoundationPile(const piles::PileId) override;
@@ -39,10 +48,26 @@ public:
         const piles::PileId, const unsigned quantity) override;
     void tryAddCardsOnTableauPile(const piles::PileId) override;
 
+    void tryMoveCardsBetweenTableauPiles(
+        const piles::PileId source, const unsigned quantity,
+        const piles::PileId destination) override;
+    void tryMoveCardFromTableauPileToFoundationPile(
+        const piles::PileId source, const piles::PileId destination) override;
+
     void trySelectNextStockPileCard() override;
     void tryPullOutCardFromStockPile() override;
 
+    bool canAutoComplete() const override;
+    std::vector<moves::Move> getAutoCompleteMoves() const override;
+    void tryAutoComplete() override;
+
+    void beginTransaction() override;
+    bool tryApplyMove(const moves::Move&) override;
+    void commitTransaction() override;
+    void abortTransaction() override;
+
     bool isGameFinished() const override;
+    std::uint64_t getPositionHash() const override;
 
     const piles::interfaces::FoundationPile&
     getFoundationPile(const piles::PileId) const override;
@@ -50,34 +75,74 @@ public:
     getTableauPile(const piles::PileId) const override;
     const piles::interfaces::StockPile& getStockPile() const override;
     const cards::Cards& getCardsInHand() const override;
+    cards::CardSet getCardSetInHand() const override;
 
 private:
     using SnapshotPtr = std::unique_ptr<archivers::interfaces::Snapshot>;
 
     void initializeFoundationPiles();
+    void initializePilesFromGameState(const GameState&);
 
     cards::Deck::const_iterator
     initializeTableauPilesAndReturnFirstNotUsedCard(const cards::Deck&);
 
-    void tryAddPulledOutCardToHand(const std::optional<cards::Card>&, SnapshotPtr);
-    void tryAddPulledOutCardsToHand(cards::Cards&&, SnapshotPtr);
-    void tryAddCardOnFoundationPileFromHand(
-        std::shared_ptr<piles::interfaces::FoundationPile>&);
-    void tryAddCardOnTableauPileFromHand(
-        std::shared_ptr<piles::interfaces::TableauPile>&);
+    void resetHistory();
+    unsigned getHistorySize() const;
+    void saveHistory(SnapshotPtr, const archivers::MoveRecord&);
+    void undoMoveRecord(const archivers::MoveRecord&);
+    void redoMoveRecord(const archivers::MoveRecord&);
+    void moveCardsBetweenPiles(const unsigned sourcePileIndex,
+                               const unsigned destinationPileIndex,
+                               const unsigned quantity);
+    cards::Cards pullOutCardsFromPile(const unsigned pileIndex, const unsigned quantity);
+    void putBackCardsOnPile(const unsigned pileIndex, const cards::Cards&);
+
+    void tryAddPulledOutCardToHand(
+        const std::optional<cards::Card>&, SnapshotPtr, const unsigned sourcePileIndex);
+    void tryAddPulledOutCardsToHand(
+        cards::Cards&&, SnapshotPtr, const unsigned sourcePileIndex);
+    void tryAddCardOnFoundationPileFromHand(const piles::PileId);
+    void tryAddCardOnTableauPileFromHand(const piles::PileId);
     void saveHistoryIfCardMovedToOtherPileAndClearHand(
-        const std::optional<cards::Card>&, SnapshotPtr);
-    void saveHistoryIfCardMovedToOtherPile(SnapshotPtr);
+        const std::optional<cards::Card>&, SnapshotPtr, const archivers::MoveRecord&);
+    void saveHistoryIfCardMovedToOtherPile(SnapshotPtr, const archivers::MoveRecord&);
+    bool canMoveCardsBetweenTableauPiles(
+        const piles::interfaces::TableauPile& source, const unsigned quantity,
+        const piles::interfaces::TableauPile& destination) const;
+    bool canMoveCardFromTableauPileToFoundationPile(
+        const piles::interfaces::TableauPile& source,
+        const piles::interfaces::FoundationPile& destination) const;
+    void saveHistoryOfMoveBetweenPiles(SnapshotPtr source, SnapshotPtr destination,
+                                       const archivers::MoveRecord&);
+    void clearHand();
+    void countFoundationPilesCards();
+
+    bool tryApplyMoveOnPiles(const moves::Move&);
+    bool tryMoveStockPileCardToTableauPile(const piles::PileId);
+    bool tryMoveStockPileCardToFoundationPile(const piles::PileId);
+    bool tryMoveFoundationPileCardToTableauPile(
+        const piles::PileId source, const piles::PileId destination);
+    std::optional<cards::Card> getSelectedStockPileCard() const;
+    void saveTransactionSnapshotOnce(
+        const unsigned pileIndex, archivers::interfaces::Archiver&);
+    void saveTransactionHistory();
+    void endTransaction();
 
     bool shouldUndoOperation() const;
+    bool shouldRedoOperation() const;
     bool shouldAddCardOnFoundationPile() const;
     bool isCardAdded(const std::optional<cards::Card>&) const;
     bool shouldUncoverTableauPileTopCard(
         const std::shared_ptr<piles::interfaces::TableauPile>&) const;
     bool shouldSelectNextStockPileCard() const;
     bool isGameInProgressAndHandContainsCards() const;
-    bool isGameInProgressAndHandIsEmpty() const;
+    bool isGameInProgressAndIdle() const;
 
+    void throwExceptionOnCardsInHand() const;
+    void throwExceptionIfTransactionCannotBegin() const;
+    void throwExceptionOnTransactionInProgress(const std::string& operation) const;
+    void throwExceptionOnNoTransactionInProgress() const;
+    void throwExceptionOnInvalidGameState(const GameState&) const;
     void throwExceptionOnInvalidFoundationPileId(const piles::PileId) const;
     void throwExceptionOnInvalidTableauPileId(const piles::PileId) const;
 
@@ -88,7 +153,16 @@ private:
     std::unique_ptr<archivers::interfaces::HistoryTracker> historyTracker;
     std::unique_ptr<archivers::interfaces::MoveCardsOperationSnapshotCreator>
         moveCardsOperationSnapshotCreator;
+    std::unique_ptr<archivers::interfaces::MoveRecordsHistoryTracker>
+        moveRecordsHistoryTracker;
     cards::Cards cardsInHand;
+    cards::CardSet cardSetInHand;
+    unsigned handSourcePileIndex {0};
+    unsigned foundationPilesCardsCount {0};
+    bool isTransactionInProgress {false};
+    std::vector<unsigned> transactionPilesIndexes;
+    std::vector<SnapshotPtr> transactionSnapshots;
+    archivers::MoveRecords transactionMoveRecords;
 };
 
 }
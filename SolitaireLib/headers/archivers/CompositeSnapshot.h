@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "interfaces/archivers/Snapshot.h"
+
+namespace solitaire::archivers {
+
+class CompositeSnapshot: public interfaces::Snapshot {
+public:
+    using Snapshots = std::vector<std::unique_ptr<interfaces::Snapshot>>;
+
+    explicit CompositeSnapshot(Snapshots);
+
+    void restore() const override;
+    bool isSnapshotOfSameObject(const interfaces::Snapshot&) const override;
+    const void* getObjectKey() const override;
+    std::size_t getMemoryUsage() const override;
+
+private:
+    Snapshots snapshots;
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include "interfaces/archivers/HistoryTracker.h"
 
@@ -7,17 +8,38 @@ namespace solitaire::archivers {
 
 class HistoryTracker: public interfaces::HistoryTracker {
 public:
-    HistoryTracker(const unsigned historyMaxSize = 10);
+    static constexpr std::size_t defaultMemoryLimit {256 * 1024};
+
+    explicit HistoryTracker(const std::size_t memoryLimit = defaultMemoryLimit);
 
     void reset() override;
     void save(std::unique_ptr<interfaces::Snapshot>) override;
     void undo() override;
 
     unsigned getHistorySize() const override;
+    std::size_t getMemoryUsage() const;
 
 private:
-    const unsigned historyMaxSize;
-    std::vector<std::unique_ptr<interfaces::Snapshot>> history;
+    struct Entry {
+        std::unique_ptr<interfaces::Snapshot> snapshot;
+        std::size_t memoryUsage {0};
+    };
+
+    static constexpr std::size_t initialCapacity {16};
+
+    void makeRoomForEntry(const std::size_t entryMemoryUsage);
+    bool canGrowCapacity(const std::size_t entryMemoryUsage) const;
+    void growCapacity();
+    void removeOldestEntry();
+    void removeNewestEntry();
+    Entry& getEntry(const std::size_t position);
+    const Entry& getEntry(const std::size_t position) const;
+
+    const std::size_t memoryLimit;
+    std::vector<Entry> entries;
+    std::size_t firstEntryIndex {0};
+    std::size_t entriesCount {0};
+    std::size_t olderEntriesMemoryUsage {0};
 };
 
 }
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "GameState.h"
+#include "moves/Move.h"
+
+namespace solitaire::archivers {
+
+// Analysis-only record of explored move sequences. Solitaire does not record into it,
+// so it is not part of the game's undo/redo history.
+class HistoryTree {
+public:
+    using NodeId = std::uint32_t;
+
+    static constexpr NodeId rootNodeId {0};
+    static constexpr unsigned defaultCheckpointInterval {32};
+
+    explicit HistoryTree(const GameState& initialGameState,
+                         const unsigned checkpointInterval = defaultCheckpointInterval);
+
+    NodeId addMove(const moves::Move&);
+    bool tryUndo();
+    bool tryRedo();
+    void seek(const NodeId);
+
+    const GameState& getGameState() const;
+    NodeId getCurrentNodeId() const;
+    std::optional<NodeId> getParentNodeId(const NodeId) const;
+    std::vector<NodeId> getChildrenNodesIds(const NodeId) const;
+    moves::Move getMove(const NodeId) const;
+    unsigned getDepth(const NodeId) const;
+
+    std::size_t getNodesCount() const;
+    std::size_t getCheckpointsCount() const;
+    std::size_t getMemoryUsage() const;
+
+private:
+    static constexpr NodeId noNodeId {UINT32_MAX};
+    static constexpr std::uint32_t noCheckpointIndex {UINT32_MAX};
+
+    struct Node {
+        NodeId parentId {noNodeId};
+        NodeId firstChildId {noNodeId};
+        NodeId nextSiblingId {noNodeId};
+        NodeId lastVisitedChildId {noNodeId};
+        std::uint32_t checkpointIndex {noCheckpointIndex};
+        std::uint32_t depth {0};
+        moves::Move move;
+    };
+
+    std::optional<NodeId> findChildNodeId(const NodeId parentId, const moves::Move&) const;
+    NodeId addChildNode(const NodeId parentId, const moves::Move&);
+    void saveCheckpointIfNeeded(const NodeId);
+    void goToChildNode(const NodeId);
+
+    void throwExceptionOnIllegalMove(const moves::Move&) const;
+    void throwExceptionOnInvalidNodeId(const NodeId) const;
+
+    const unsigned checkpointInterval;
+    std::vector<Node> nodes;
+    std::vector<GameState> checkpoints;
+    GameState gameState;
+    NodeId currentNodeId {rootNodeId};
+};
+
+}
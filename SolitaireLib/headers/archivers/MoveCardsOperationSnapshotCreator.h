@@ -1,5 +1,6 @@
 #pragma once
 
+#include "archivers/SnapshotsPool.h"
 #include "interfaces/archivers/MoveCardsOperationSnapshotCreator.h"
 #include "interfaces/archivers/Snapshot.h"
 
@@ -12,6 +13,9 @@ private:
     class Snapshot;
 
 public:
+    MoveCardsOperationSnapshotCreator();
+    explicit MoveCardsOperationSnapshotCreator(std::shared_ptr<SnapshotsPool>);
+
     std::unique_ptr<interfaces::Snapshot> createSnapshotIfCardsMovedToOtherPile(
         std::unique_ptr<interfaces::Snapshot> destinationPileSnapshot) override;
 
@@ -23,16 +27,19 @@ private:
     void throwIfSourcePileSnapshotIsNotNullptr() const;
     void throwIfSnapshotIsNullptr(const std::unique_ptr<interfaces::Snapshot>&) const;
 
+    std::shared_ptr<SnapshotsPool> snapshotsPool;
     std::unique_ptr<interfaces::Snapshot> sourcePileSnapshot;
 };
 
-class MoveCardsOperationSnapshotCreator::Snapshot: public interfaces::Snapshot {
+class MoveCardsOperationSnapshotCreator::Snapshot: public PooledSnapshot {
 public:
     Snapshot(std::unique_ptr<interfaces::Snapshot> sourcePileSnapshot,
              std::unique_ptr<interfaces::Snapshot> destinationPileSnapshot);
 
     void restore() const override;
     bool isSnapshotOfSameObject(const interfaces::Snapshot&) const override;
+    const void* getObjectKey() const override;
+    std::size_t getMemoryUsage() const override;
 
 private:
     std::unique_ptr<interfaces::Snapshot> sourcePileSnapshot;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace solitaire::archivers {
+
+struct MoveRecord {
+    enum class Type: std::uint8_t {
+        MoveCards,
+        UncoverTableauPileTopCard,
+        SelectNextStockPileCard
+    };
+
+    constexpr MoveRecord(const Type type, const unsigned sourcePileIndex,
+                         const unsigned destinationPileIndex, const unsigned cardsCount = 0);
+
+    Type type;
+    std::uint8_t sourcePileIndex;
+    std::uint8_t destinationPileIndex;
+    std::uint8_t cardsCount;
+};
+
+using MoveRecords = std::vector<MoveRecord>;
+
+constexpr MoveRecord::MoveRecord(const Type type, const unsigned sourcePileIndex,
+                                 const unsigned destinationPileIndex,
+                                 const unsigned cardsCount):
+    type {type},
+    sourcePileIndex {static_cast<std::uint8_t>(sourcePileIndex)},
+    destinationPileIndex {static_cast<std::uint8_t>(destinationPileIndex)},
+    cardsCount {static_cast<std::uint8_t>(cardsCount)} {
+}
+
+constexpr bool operator==(const MoveRecord& lhs, const MoveRecord& rhs) {
+    return lhs.type == rhs.type and
+        lhs.sourcePileIndex == rhs.sourcePileIndex and
+        lhs.destinationPileIndex == rhs.destinationPileIndex and
+        lhs.cardsCount == rhs.cardsCount;
+}
+
+constexpr bool operator!=(const MoveRecord& lhs, const MoveRecord& rhs) {
+    return not (lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const MoveRecord& record);
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include "interfaces/archivers/MoveRecordsHistoryTracker.h"
+
+namespace solitaire::archivers {
+
+class MoveRecordsHistoryTracker: public interfaces::MoveRecordsHistoryTracker {
+public:
+    static constexpr std::size_t defaultMemoryLimit {256 * 1024};
+
+    explicit MoveRecordsHistoryTracker(const std::size_t memoryLimit = defaultMemoryLimit);
+
+    void reset() override;
+    void save(const MoveRecord&) override;
+    void save(const MoveRecords&) override;
+    MoveRecords undo() override;
+    MoveRecords redo() override;
+
+    unsigned getHistorySize() const override;
+    unsigned getRedoSize() const override;
+    std::size_t getMemoryUsage() const;
+
+private:
+    template <class Iterator>
+    void saveEntry(Iterator firstRecord, Iterator lastRecord);
+    void discardRedoEntries();
+    void removeOldestEntry();
+    MoveRecords getEntryRecords(const std::size_t firstRecordPosition,
+                                const unsigned entrySize) const;
+
+    const std::size_t memoryLimit;
+    std::deque<MoveRecord> records;
+    std::deque<unsigned> entriesSizes;
+    unsigned historySize {0};
+    std::size_t historyRecordsCount {0};
+};
+
+}
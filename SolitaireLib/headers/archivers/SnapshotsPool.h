@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "interfaces/archivers/Snapshot.h"
+
+namespace solitaire::archivers {
+
+class SnapshotsPool: public std::enable_shared_from_this<SnapshotsPool> {
+public:
+    static constexpr std::size_t maxSnapshotSize {64};
+    static constexpr std::size_t unlimitedBlocksCount {
+        std::numeric_limits<std::size_t>::max()};
+
+    explicit SnapshotsPool(const std::size_t blocksCount = 0,
+                           const std::size_t maxBlocksCount = unlimitedBlocksCount);
+
+    static constexpr std::size_t getBlockSize();
+    static std::size_t getBlocksCountForMemoryLimit(const std::size_t memoryLimit);
+
+    void* allocate(const std::size_t snapshotSize);
+    static void deallocate(void* snapshot);
+
+    std::size_t getBlocksCount() const;
+    std::size_t getMaxBlocksCount() const;
+    std::size_t getFreeBlocksCount() const;
+    std::size_t getMemoryUsage() const;
+
+private:
+    struct alignas(std::max_align_t) Block {
+        std::byte snapshot[maxSnapshotSize];
+        std::shared_ptr<SnapshotsPool> pool;
+        Block* nextFreeBlock {nullptr};
+    };
+
+    static constexpr std::size_t minBlocksPerChunk {16};
+
+    void addChunk(const std::size_t blocksCount);
+    void throwExceptionOnMaxBlocksCountReached() const;
+    void releaseBlock(Block&);
+
+    const std::size_t maxBlocksCount;
+    std::vector<std::unique_ptr<Block[]>> chunks;
+    Block* firstFreeBlock {nullptr};
+    std::size_t blocksCount {0};
+    std::size_t freeBlocksCount {0};
+};
+
+constexpr std::size_t SnapshotsPool::getBlockSize() {
+    return sizeof(Block);
+}
+
+class PooledSnapshot: public interfaces::Snapshot {
+public:
+    static void* operator new(std::size_t size, SnapshotsPool&);
+    static void operator delete(void* snapshot, SnapshotsPool&);
+    static void operator delete(void* snapshot);
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <ostream>
 
 namespace solitaire::cards {
@@ -9,23 +10,66 @@ enum class Suit;
 
 class Card {
 public:
-    Card();
-    Card(const Value value, const Suit suit);
+    constexpr Card();
+    constexpr Card(const Value value, const Suit suit);
 
-    Value getValue() const;
-    Suit getSuit() const;
+    constexpr Value getValue() const;
+    constexpr Suit getSuit() const;
+    constexpr std::uint8_t getCode() const;
 
-    bool hasValueOneGreaterThan(const Card& card) const;
-    bool hasSameSuitAs(const Card& card) const;
-    bool hasDifferentColorThan(const Card& card) const;
-    bool hasRedColor() const;
+    constexpr bool hasValueOneGreaterThan(const Card& card) const;
+    constexpr bool hasSameSuitAs(const Card& card) const;
+    constexpr bool hasDifferentColorThan(const Card& card) const;
+    constexpr bool hasRedColor() const;
+
+    static constexpr unsigned suitShift {4};
+    static constexpr std::uint8_t valueMask {0x0F};
+    static constexpr std::uint8_t blackColorMask {1 << suitShift};
 
 private:
-    Value value;
-    Suit suit;
+    std::uint8_t code;
 };
 
-bool operator==(const Card& lhs, const Card& rhs);
+constexpr Card::Card(): code {0} {
+}
+
+constexpr Card::Card(const Value value, const Suit suit):
+    code {static_cast<std::uint8_t>(
+        static_cast<unsigned>(suit) << suitShift | static_cast<unsigned>(value))} {
+}
+
+constexpr Value Card::getValue() const {
+    return static_cast<Value>(code & valueMask);
+}
+
+constexpr Suit Card::getSuit() const {
+    return static_cast<Suit>(code >> suitShift);
+}
+
+constexpr std::uint8_t Card::getCode() const {
+    return code;
+}
+
+constexpr bool Card::hasValueOneGreaterThan(const Card& card) const {
+    return (code & valueMask) == (card.code & valueMask) + 1;
+}
+
+constexpr bool Card::hasSameSuitAs(const Card& card) const {
+    return (code ^ card.code) >> suitShift == 0;
+}
+
+constexpr bool Card::hasDifferentColorThan(const Card& card) const {
+    return ((code ^ card.code) & blackColorMask) != 0;
+}
+
+constexpr bool Card::hasRedColor() const {
+    return (code & blackColorMask) == 0;
+}
+
+constexpr bool operator==(const Card& lhs, const Card& rhs) {
+    return lhs.getCode() == rhs.getCode();
+}
+
 std::ostream& operator<<(std::ostream& os, const Card& card);
 
 }
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "cards/Card.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+
+namespace solitaire::cards {
+
+constexpr unsigned cardCodesCount {64};
+using CardCodesMasks = std::array<std::uint64_t, cardCodesCount>;
+
+constexpr bool isValidCardCode(const unsigned code);
+constexpr Card getCardFromCode(const unsigned code);
+
+constexpr std::uint64_t getCardMask(const Card& card);
+constexpr std::uint64_t getCardsPlaceableOnTableauCard(const Card& tableauCard);
+constexpr std::uint64_t getCardsFollowingOnFoundation(const Card& foundationCard);
+
+constexpr bool canBePlacedOnTableauCard(const Card& card, const Card& tableauCard);
+constexpr bool canBePlacedOnEmptyTableau(const Card& card);
+constexpr bool canFollowOnFoundation(const Card& card, const Card& foundationCard);
+constexpr bool canBePlacedOnEmptyFoundation(const Card& card);
+
+constexpr bool isValidCardCode(const unsigned code) {
+    return code < cardCodesCount and (code & Card::valueMask) <= to_int(Value::King);
+}
+
+constexpr Card getCardFromCode(const unsigned code) {
+    return Card {Value (code & Card::valueMask), Suit (code >> Card::suitShift)};
+}
+
+template <class Predicate>
+constexpr CardCodesMasks createCardCodesMasks(Predicate predicate) {
+    CardCodesMasks masks {};
+    for (unsigned pileCode = 0; pileCode < cardCodesCount; ++pileCode)
+        for (unsigned code = 0; code < cardCodesCount; ++code)
+            if (isValidCardCode(pileCode) and isValidCardCode(code) and
+                predicate(getCardFromCode(code), getCardFromCode(pileCode)))
+                masks[pileCode] |= std::uint64_t {1} << code;
+    return masks;
+}
+
+inline constexpr CardCodesMasks cardsPlaceableOnTableauCard {createCardCodesMasks(
+    [](const Card& card, const Card& tableauCard) {
+        return tableauCard.hasValueOneGreaterThan(card) and
+               tableauCard.hasDifferentColorThan(card);
+    })};
+
+inline constexpr CardCodesMasks cardsFollowingOnFoundation {createCardCodesMasks(
+    [](const Card& card, const Card& foundationCard) {
+        return card.hasValueOneGreaterThan(foundationCard) and
+               card.hasSameSuitAs(foundationCard);
+    })};
+
+constexpr std::uint64_t getCardMask(const Card& card) {
+    return std::uint64_t {1} << card.getCode();
+}
+
+constexpr std::uint64_t getCardsPlaceableOnTableauCard(const Card& tableauCard) {
+    return cardsPlaceableOnTableauCard[tableauCard.getCode()];
+}
+
+constexpr std::uint64_t getCardsFollowingOnFoundation(const Card& foundationCard) {
+    return cardsFollowingOnFoundation[foundationCard.getCode()];
+}
+
+constexpr bool canBePlacedOnTableauCard(const Card& card, const Card& tableauCard) {
+    return (getCardsPlaceableOnTableauCard(tableauCard) & getCardMask(card)) != 0;
+}
+
+constexpr bool canBePlacedOnEmptyTableau(const Card& card) {
+    return (card.getCode() & Card::valueMask) == to_int(Value::King);
+}
+
+constexpr bool canFollowOnFoundation(const Card& card, const Card& foundationCard) {
+    return (getCardsFollowingOnFoundation(foundationCard) & getCardMask(card)) != 0;
+}
+
+constexpr bool canBePlacedOnEmptyFoundation(const Card& card) {
+    return (card.getCode() & Card::valueMask) == to_int(Value::Ace);
+}
+
+}
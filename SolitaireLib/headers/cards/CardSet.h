@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include "cards/Card.h"
+
+namespace solitaire::cards {
+
+class CardSet {
+public:
+    constexpr CardSet();
+    constexpr explicit CardSet(const std::uint64_t bits);
+
+    template <class InputIterator>
+    CardSet(InputIterator begin, const InputIterator end);
+
+    static constexpr CardSet allCards();
+
+    constexpr void insert(const Card& card);
+    constexpr void erase(const Card& card);
+
+    template <class InputIterator>
+    void insert(InputIterator begin, const InputIterator end);
+    template <class InputIterator>
+    void erase(InputIterator begin, const InputIterator end);
+
+    constexpr bool contains(const Card& card) const;
+    constexpr unsigned size() const;
+    constexpr bool empty() const;
+    constexpr std::uint64_t getBits() const;
+
+    static constexpr std::uint64_t allCardsBits {0x1FFF1FFF1FFF1FFF};
+
+private:
+    static constexpr std::uint64_t getCardBit(const Card& card);
+
+    std::uint64_t bits;
+};
+
+constexpr CardSet::CardSet(): bits {0} {
+}
+
+constexpr CardSet::CardSet(const std::uint64_t bits): bits {bits} {
+}
+
+template <class InputIterator>
+CardSet::CardSet(InputIterator begin, const InputIterator end): bits {0} {
+    insert(begin, end);
+}
+
+constexpr CardSet CardSet::allCards() {
+    return CardSet {allCardsBits};
+}
+
+constexpr void CardSet::insert(const Card& card) {
+    bits |= getCardBit(card);
+}
+
+constexpr void CardSet::erase(const Card& card) {
+    bits &= ~getCardBit(card);
+}
+
+template <class InputIterator>
+void CardSet::insert(InputIterator begin, const InputIterator end) {
+    for (; begin != end; ++begin)
+        insert(*begin);
+}
+
+template <class InputIterator>
+void CardSet::erase(InputIterator begin, const InputIterator end) {
+    for (; begin != end; ++begin)
+        erase(*begin);
+}
+
+constexpr bool CardSet::contains(const Card& card) const {
+    return (bits & getCardBit(card)) != 0;
+}
+
+constexpr unsigned CardSet::size() const {
+    auto count = bits - ((bits >> 1) & 0x5555555555555555);
+    count = (count & 0x3333333333333333) + ((count >> 2) & 0x3333333333333333);
+    count = (count + (count >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return (count * 0x0101010101010101) >> 56;
+}
+
+constexpr bool CardSet::empty() const {
+    return bits == 0;
+}
+
+constexpr std::uint64_t CardSet::getBits() const {
+    return bits;
+}
+
+constexpr std::uint64_t CardSet::getCardBit(const Card& card) {
+    return std::uint64_t {1} << card.getCode();
+}
+
+constexpr CardSet operator|(const CardSet& lhs, const CardSet& rhs) {
+    return CardSet {lhs.getBits() | rhs.getBits()};
+}
+
+constexpr CardSet operator&(const CardSet& lhs, const CardSet& rhs) {
+    return CardSet {lhs.getBits() & rhs.getBits()};
+}
+
+constexpr CardSet operator-(const CardSet& lhs, const CardSet& rhs) {
+    return CardSet {lhs.getBits() & ~rhs.getBits()};
+}
+
+constexpr bool operator==(const CardSet& lhs, const CardSet& rhs) {
+    return lhs.getBits() == rhs.getBits();
+}
+
+constexpr bool operator!=(const CardSet& lhs, const CardSet& rhs) {
+    return not (lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const CardSet& cardSet);
+
+}
@@ -1,10 +1,253 @@
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "cards/Card.h"
 
 namespace solitaire::cards {
 
-class Card;
-using Cards = std::vector<Card>;
+class Cards {
+public:
+    static constexpr std::size_t capacity {24};
+
+    using value_type = Card;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Card&;
+    using const_reference = const Card&;
+    using pointer = Card*;
+    using const_pointer = const Card*;
+    using iterator = Card*;
+    using const_iterator = const Card*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    Cards() = default;
+    explicit Cards(const size_type count, const Card& card = Card {});
+    Cards(std::initializer_list<Card> cards);
+
+    template <class InputIterator>
+    Cards(InputIterator first, InputIterator last);
+
+    template <class InputIterator>
+    void assign(InputIterator first, InputIterator last);
+
+    iterator insert(const_iterator position, const Card& card);
+    template <class InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last);
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+
+    void push_back(const Card& card);
+    void pop_back();
+    void clear();
+
+    Card& operator[](const size_type index);
+    const Card& operator[](const size_type index) const;
+    Card& at(const size_type index);
+    const Card& at(const size_type index) const;
+
+    Card& front();
+    const Card& front() const;
+    Card& back();
+    const Card& back() const;
+
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+
+    size_type size() const;
+    bool empty() const;
+
+private:
+    iterator toIterator(const_iterator position);
+    void throwExceptionOnCapacityExceeded(const size_type newSize) const;
+
+    std::array<Card, capacity> cards;
+    std::uint8_t cardsCount {0};
+};
+
+bool operator==(const Cards& lhs, const Cards& rhs);
+bool operator!=(const Cards& lhs, const Cards& rhs);
+
+inline Cards::Cards(const size_type count, const Card& card) {
+    throwExceptionOnCapacityExceeded(count);
+    std::fill_n(begin(), count, card);
+    cardsCount = count;
+}
+
+inline Cards::Cards(std::initializer_list<Card> cards) {
+    assign(cards.begin(), cards.end());
+}
+
+template <class InputIterator>
+Cards::Cards(InputIterator first, InputIterator last) {
+    assign(first, last);
+}
+
+template <class InputIterator>
+void Cards::assign(InputIterator first, InputIterator last) {
+    clear();
+    insert(end(), first, last);
+}
+
+inline Cards::iterator Cards::insert(const_iterator position, const Card& card) {
+    const Card cardToInsert = card;
+    return insert(position, &cardToInsert, std::next(&cardToInsert));
+}
+
+template <class InputIterator>
+Cards::iterator Cards::insert(const_iterator position,
+                              InputIterator first, InputIterator last)
+{
+    const auto insertedCount = static_cast<size_type>(std::distance(first, last));
+    throwExceptionOnCapacityExceeded(size() + insertedCount);
+
+    const auto insertPosition = toIterator(position);
+    std::copy_backward(insertPosition, end(), end() + insertedCount);
+    std::copy(first, last, insertPosition);
+    cardsCount += insertedCount;
+    return insertPosition;
+}
+
+inline Cards::iterator Cards::erase(const_iterator position) {
+    return erase(position, std::next(position));
+}
+
+inline Cards::iterator Cards::erase(const_iterator first, const_iterator last) {
+    const auto erasePosition = toIterator(first);
+    std::copy(last, cend(), erasePosition);
+    cardsCount -= std::distance(first, last);
+    return erasePosition;
+}
+
+inline void Cards::push_back(const Card& card) {
+    throwExceptionOnCapacityExceeded(size() + 1);
+    cards[cardsCount++] = card;
+}
+
+inline void Cards::pop_back() {
+    --cardsCount;
+}
+
+inline void Cards::clear() {
+    cardsCount = 0;
+}
+
+inline Card& Cards::operator[](const size_type index) {
+    return cards[index];
+}
+
+inline const Card& Cards::operator[](const size_type index) const {
+    return cards[index];
+}
+
+inline Card& Cards::at(const size_type index) {
+    if (index >= size())
+        throw std::out_of_range {"Card index out of range"};
+    return cards[index];
+}
+
+inline const Card& Cards::at(const size_type index) const {
+    if (index >= size())
+        throw std::out_of_range {"Card index out of range"};
+    return cards[index];
+}
+
+inline Card& Cards::front() {
+    return cards.front();
+}
+
+inline const Card& Cards::front() const {
+    return cards.front();
+}
+
+inline Card& Cards::back() {
+    return cards[cardsCount - 1];
+}
+
+inline const Card& Cards::back() const {
+    return cards[cardsCount - 1];
+}
+
+inline Cards::iterator Cards::begin() {
+    return cards.data();
+}
+
+inline Cards::const_iterator Cards::begin() const {
+    return cards.data();
+}
+
+inline Cards::const_iterator Cards::cbegin() const {
+    return cards.data();
+}
+
+inline Cards::iterator Cards::end() {
+    return cards.data() + cardsCount;
+}
+
+inline Cards::const_iterator Cards::end() const {
+    return cards.data() + cardsCount;
+}
+
+inline Cards::const_iterator Cards::cend() const {
+    return cards.data() + cardsCount;
+}
+
+inline Cards::reverse_iterator Cards::rbegin() {
+    return reverse_iterator {end()};
+}
+
+inline Cards::const_reverse_iterator Cards::rbegin() const {
+    return const_reverse_iterator {end()};
+}
+
+inline Cards::reverse_iterator Cards::rend() {
+    return reverse_iterator {begin()};
+}
+
+inline Cards::const_reverse_iterator Cards::rend() const {
+    return const_reverse_iterator {begin()};
+}
+
+inline Cards::size_type Cards::size() const {
+    return cardsCount;
+}
+
+inline bool Cards::empty() const {
+    return cardsCount == 0;
+}
+
+inline Cards::iterator Cards::toIterator(const_iterator position) {
+    return begin() + (position - cbegin());
+}
+
+inline void Cards::throwExceptionOnCapacityExceeded(const size_type newSize) const {
+    if (newSize > capacity)
+        throw std::runtime_error {"Cards capacity exceeded: " + std::to_string(newSize)};
+}
+
+inline bool operator==(const Cards& lhs, const Cards& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+inline bool operator!=(const Cards& lhs, const Cards& rhs) {
+    return not (lhs == rhs);
+}
 
 }
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "cards/Deck.h"
+
+namespace solitaire::cards {
+
+class DealNumber {
+public:
+    static constexpr unsigned wordsCount {8};
+    using Words = std::array<std::uint32_t, wordsCount>;
+
+    DealNumber(const std::uint64_t number = 0);
+    DealNumber(const Words& words);
+
+    static DealNumber fromDeck(const Deck& deck);
+    Deck toDeck() const;
+
+    DealNumber& operator++();
+    const Words& getWords() const;
+
+private:
+    static const DealNumber& getDealsCount();
+
+    void multiplyAndAdd(const std::uint32_t multiplier, const std::uint32_t addend);
+
+    Words words;
+};
+
+bool operator==(const DealNumber& lhs, const DealNumber& rhs);
+bool operator!=(const DealNumber& lhs, const DealNumber& rhs);
+std::ostream& operator<<(std::ostream& os, const DealNumber& dealNumber);
+std::string to_string(const DealNumber& dealNumber);
+
+}
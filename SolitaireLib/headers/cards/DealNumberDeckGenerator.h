@@ -0,0 +1,18 @@
+#pragma once
+
+#include "cards/DealNumber.h"
+#include "interfaces/cards/DeckGenerator.h"
+
+namespace solitaire::cards {
+
+class DealNumberDeckGenerator: public interfaces::DeckGenerator {
+public:
+    DealNumberDeckGenerator(const DealNumber& firstDealNumber);
+
+    Deck generate() const override;
+
+private:
+    mutable DealNumber nextDealNumber;
+};
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "interfaces/cards/DeckGenerator.h"
+
+namespace solitaire::cards {
+
+class SeededDeckGenerator: public interfaces::DeckGenerator {
+public:
+    SeededDeckGenerator(const std::uint64_t seed,
+                        const std::uint64_t firstDealNumber = 0,
+                        const std::uint64_t dealNumberStride = 1);
+
+    Deck generate() const override;
+
+    static Deck generateDeal(const std::uint64_t seed,
+                             const std::uint64_t dealNumber);
+    static void generateBatch(const std::uint64_t seed,
+                              const std::size_t count, Deck* decks);
+
+private:
+    const std::uint64_t seed;
+    const std::uint64_t dealNumberStride;
+    mutable std::uint64_t nextDealNumber;
+};
+
+}
@@ -8,7 +8,7 @@ enum class Suit {
     Heart, Spade, Diamond, Club
 };
 
-inline int to_int(const Suit& suit) {
+constexpr int to_int(const Suit& suit) {
     return static_cast<int>(suit);
 }
 
@@ -10,7 +10,7 @@ enum class Value {
     Jack, Queen, King
 };
 
-inline int to_int(const Value& value) {
+constexpr int to_int(const Value& value) {
     return static_cast<int>(value);
 }
 
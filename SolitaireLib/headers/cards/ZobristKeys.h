@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "cards/Card.h"
+#include "cards/CardPlacementRules.h"
+
+namespace solitaire::cards {
+
+enum class CardLocation {
+    TableauPileUncovered,
+    TableauPileCovered,
+    FoundationPile,
+    StockPileStock,
+    StockPileWaste
+};
+
+constexpr unsigned cardLocationsCount {5};
+constexpr unsigned zobristHashPileRotation {5};
+
+using ZobristKeys = std::array<std::array<std::uint64_t, cardCodesCount>, cardLocationsCount>;
+
+constexpr ZobristKeys createZobristKeys() {
+    ZobristKeys keys {};
+    std::uint64_t state = 0x5EED'5011'7A1Eull;
+    for (auto& locationKeys: keys)
+        for (auto& key: locationKeys) {
+            state += 0x9E37'79B9'7F4A'7C15ull;
+            std::uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EBull;
+            key = z ^ (z >> 31);
+        }
+    return keys;
+}
+
+inline constexpr ZobristKeys zobristKeys {createZobristKeys()};
+
+constexpr std::uint64_t getZobristKey(const CardLocation location, const Card& card) {
+    return zobristKeys[static_cast<unsigned>(location)][card.getCode()];
+}
+
+template <class InputIterator>
+std::uint64_t getZobristHash(InputIterator begin, const InputIterator end,
+                             const CardLocation location)
+{
+    std::uint64_t hash = 0;
+    for (; begin != end; ++begin)
+        hash ^= getZobristKey(location, *begin);
+    return hash;
+}
+
+constexpr std::uint64_t placeZobristHashOnPile(const std::uint64_t pileHash,
+                                               const unsigned pileIndex)
+{
+    const auto rotation = pileIndex * zobristHashPileRotation % 64;
+    return rotation == 0 ? pileHash : pileHash << rotation | pileHash >> (64 - rotation);
+}
+
+}
@@ -6,10 +6,12 @@ namespace solitaire::events {
 
 struct NoEvents;
 struct MouseLeftButtonDown;
+struct MouseLeftButtonDoubleClick;
 struct MouseLeftButtonUp;
 struct MouseMove;
 struct Quit;
 
-using Event = std::variant<NoEvents, MouseLeftButtonDown, MouseLeftButtonUp, MouseMove, Quit>;
+using Event = std::variant<NoEvents, MouseLeftButtonDown, MouseLeftButtonDoubleClick,
+                           MouseLeftButtonUp, MouseMove, Quit>;
 
 }
@@ -10,6 +10,10 @@ struct MouseLeftButtonDown {
     geometry::Position position;
 };
 
+struct MouseLeftButtonDoubleClick {
+    geometry::Position position;
+};
+
 struct MouseLeftButtonUp {};
 
 struct MouseMove {
@@ -26,6 +30,12 @@ inline bool operator==(const MouseLeftButtonDown& lhs, const MouseLeftButtonDown
     return lhs.position == rhs.position;
 }
 
+inline bool operator==(
+    const MouseLeftButtonDoubleClick& lhs, const MouseLeftButtonDoubleClick& rhs)
+{
+    return lhs.position == rhs.position;
+}
+
 inline bool operator==(const MouseLeftButtonUp& lhs, const MouseLeftButtonUp& rhs) {
     return true;
 }
@@ -64,6 +64,7 @@ private:
 
     void processEvent(const Event& event);
     void processMouseLeftButtonDownEvent(const MouseLeftButtonDown&) const;
+    void processMouseLeftButtonDoubleClickEvent(const MouseLeftButtonDoubleClick&) const;
     void processMouseLeftButtonUpEvent() const;
     void processMouseMoveEvent(const MouseMove&) const;
     void processButtonsHoverState(const MouseMove&) const;
@@ -26,6 +26,10 @@ namespace solitaire::interfaces {
 class Context;
 }
 
+namespace solitaire::moves {
+class Move;
+}
+
 namespace solitaire::graphics {
 
 class Renderer: public interfaces::Renderer {
@@ -61,6 +65,8 @@ private:
     void renderStockPileUncoveredCards(
         const cards::Cards&, const SelectedCardIndex&,
         const colliders::interfaces::StockPileCollider&) const;
+    void renderHint() const;
+    void renderTableauPileHint(const piles::PileId, const unsigned quantity) const;
     void renderCardsInHand() const;
     void renderCard(const geometry::Position&, const cards::Card&) const;
     void renderCardBack(const geometry::Position&) const;
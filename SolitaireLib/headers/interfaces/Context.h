@@ -14,6 +14,10 @@ namespace solitaire::piles {
 struct PileId;
 }
 
+namespace solitaire::solvers::interfaces {
+class HintEngine;
+}
+
 namespace solitaire::interfaces {
 class Button;
 class Solitaire;
@@ -52,6 +56,9 @@ public:
     virtual interfaces::Button& getUndoButton() = 0;
     virtual const interfaces::Button& getUndoButton() const = 0;
 
+    virtual solvers::interfaces::HintEngine& getHintEngine() = 0;
+    virtual const solvers::interfaces::HintEngine& getHintEngine() const = 0;
+
     virtual geometry::Position getMousePosition() const = 0;
     virtual geometry::Position getCardsInHandPosition() const = 0;
 };
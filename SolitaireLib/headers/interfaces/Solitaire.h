@@ -1,10 +1,21 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
+#include "cards/CardSet.h"
 #include "cards/Cards.h"
 
+namespace solitaire {
+    struct GameState;
+}
+
+namespace solitaire::moves {
+    class Move;
+}
+
 namespace solitaire::piles {
     struct PileId;
 }
@@ -31,7 +42,11 @@ public:
 
     virtual void startNewGame() = 0;
 
+    virtual GameState exportGameState() const = 0;
+    virtual void importGameState(const GameState&) = 0;
+
     virtual void tryUndoOperation() = 0;
+    virtual void tryRedoOperation() = 0;
     virtual void tryPutCardsBackFromHand() = 0;
 
     virtual void tryPullOutCardFromFoundationPile(const piles::PileId) = 0;
@@ -42,10 +57,26 @@ public:
         const piles::PileId, const unsigned quantity) = 0;
     virtual void tryAddCardsOnTableauPile(const piles::PileId) = 0;
 
+    virtual void tryMoveCardsBetweenTableauPiles(
+        const piles::PileId source, const unsigned quantity,
+        const piles::PileId destination) = 0;
+    virtual void tryMoveCardFromTableauPileToFoundationPile(
+        const piles::PileId source, const piles::PileId destination) = 0;
+
     virtual void trySelectNextStockPileCard() = 0;
     virtual void tryPullOutCardFromStockPile() = 0;
 
+    virtual bool canAutoComplete() const = 0;
+    virtual std::vector<moves::Move> getAutoCompleteMoves() const = 0;
+    virtual void tryAutoComplete() = 0;
+
+    virtual void beginTransaction() = 0;
+    virtual bool tryApplyMove(const moves::Move&) = 0;
+    virtual void commitTransaction() = 0;
+    virtual void abortTransaction() = 0;
+
     virtual bool isGameFinished() const = 0;
+    virtual std::uint64_t getPositionHash() const = 0;
 
     virtual const piles::interfaces::FoundationPile&
     getFoundationPile(const piles::PileId) const = 0;
@@ -53,6 +84,7 @@ public:
     getTableauPile(const piles::PileId) const = 0;
     virtual const piles::interfaces::StockPile& getStockPile() const = 0;
     virtual const cards::Cards& getCardsInHand() const = 0;
+    virtual cards::CardSet getCardSetInHand() const = 0;
 };
 
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "archivers/MoveRecord.h"
+
+namespace solitaire::archivers::interfaces {
+
+class MoveRecordsHistoryTracker {
+public:
+    virtual ~MoveRecordsHistoryTracker() = default;
+    virtual void reset() = 0;
+    virtual void save(const MoveRecord&) = 0;
+    virtual void save(const MoveRecords&) = 0;
+    virtual MoveRecords undo() = 0;
+    virtual MoveRecords redo() = 0;
+    virtual unsigned getHistorySize() const = 0;
+    virtual unsigned getRedoSize() const = 0;
+};
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace solitaire::archivers::interfaces {
 
 class Snapshot {
@@ -7,6 +9,8 @@ public:
     virtual ~Snapshot() = default;
     virtual void restore() const = 0;
     virtual bool isSnapshotOfSameObject(const Snapshot&) const = 0;
+    virtual const void* getObjectKey() const = 0;
+    virtual std::size_t getMemoryUsage() const = 0;
 };
 
 }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 
+#include "cards/CardSet.h"
 #include "cards/Cards.h"
+#include "cards/Deck.h"
 #include "interfaces/archivers/Archiver.h"
 
 namespace solitaire::cards {
@@ -16,11 +19,18 @@ public:
     virtual ~FoundationPile() = default;
 
     virtual void initialize() = 0;
+    virtual void initialize(const cards::Deck::const_iterator& begin,
+                            const cards::Deck::const_iterator& end) = 0;
 
     virtual void tryAddCard(std::optional<cards::Card>& cardToAdd) = 0;
     virtual std::optional<cards::Card> tryPullOutCard() = 0;
 
+    virtual bool canAddCard(const cards::Card& cardToAdd) const = 0;
+    virtual bool canPullOutCard() const = 0;
+
     virtual const cards::Cards& getCards() const = 0;
+    virtual cards::CardSet getCardSet() const = 0;
+    virtual std::uint64_t getPositionHash() const = 0;
     virtual std::optional<cards::Value> getTopCardValue() const = 0;
 };
 
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 
+#include "cards/CardSet.h"
 #include "cards/Cards.h"
 #include "cards/Deck.h"
 #include "interfaces/archivers/Archiver.h"
@@ -14,11 +16,19 @@ public:
 
     virtual void initialize(const cards::Deck::const_iterator& begin,
                             const cards::Deck::const_iterator& end) = 0;
+    virtual void initialize(const cards::Deck::const_iterator& begin,
+                            const cards::Deck::const_iterator& end,
+                            const std::optional<unsigned> selectedCardIndex) = 0;
 
     virtual void trySelectNextCard() = 0;
+    virtual void trySelectPreviousCard() = 0;
     virtual std::optional<cards::Card> tryPullOutCard() = 0;
+    virtual void putBackCard(const cards::Card&) = 0;
+    virtual bool canPullOutCard() const = 0;
 
     virtual const cards::Cards& getCards() const = 0;
+    virtual cards::CardSet getCardSet() const = 0;
+    virtual std::uint64_t getPositionHash() const = 0;
     virtual std::optional<unsigned> getSelectedCardIndex() const = 0;
 };
 
@@ -1,23 +1,44 @@
 #pragma once
 
+#include <cstdint>
+#include "cards/CardSet.h"
 #include "cards/Cards.h"
 #include "cards/Deck.h"
 #include "interfaces/archivers/Archiver.h"
 
 namespace solitaire::piles::interfaces {
 
+class FoundationPile;
+
 class TableauPile: public archivers::interfaces::Archiver {
 public:
     virtual ~TableauPile() = default;
 
     virtual void initialize(const cards::Deck::const_iterator& begin,
                             const cards::Deck::const_iterator& end) = 0;
+    virtual void initialize(const cards::Deck::const_iterator& begin,
+                            const cards::Deck::const_iterator& end,
+                            const unsigned topCoveredCardPosition) = 0;
 
     virtual void tryUncoverTopCard() = 0;
+    virtual void tryCoverTopCard() = 0;
     virtual void tryAddCards(cards::Cards& cardsToAdd) = 0;
+    virtual bool tryAddCards(cards::Cards::const_iterator firstCardToAdd,
+                             cards::Cards::const_iterator lastCardToAdd) = 0;
     virtual cards::Cards tryPullOutCards(unsigned quantity) = 0;
+    virtual bool tryMoveCards(unsigned quantity, TableauPile& destinationPile) = 0;
+    virtual bool tryMoveTopCard(FoundationPile& destinationPile) = 0;
+    virtual void putBackCards(cards::Cards::const_iterator firstCardToPutBack,
+                              cards::Cards::const_iterator lastCardToPutBack) = 0;
+
+    virtual bool canAddCards(cards::Cards::const_iterator firstCardToAdd,
+                             cards::Cards::const_iterator lastCardToAdd) const = 0;
+    virtual bool canPullOutCards(unsigned quantity) const = 0;
 
     virtual const cards::Cards& getCards() const = 0;
+    virtual cards::CardSet getCardSet() const = 0;
+    virtual std::uint64_t getPositionHash() const = 0;
+    virtual cards::CardSet getCoveredCardSet() const = 0;
     virtual unsigned getTopCoveredCardPosition() const = 0;
     virtual bool isTopCardCovered() const = 0;
 };
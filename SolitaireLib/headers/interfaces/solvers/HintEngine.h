@@ -0,0 +1,21 @@
+#pragma once
+
+#include <optional>
+
+#include "moves/Move.h"
+
+namespace solitaire::interfaces {
+class Solitaire;
+}
+
+namespace solitaire::solvers::interfaces {
+
+class HintEngine {
+public:
+    virtual ~HintEngine() = default;
+
+    virtual void analyzePosition(const solitaire::interfaces::Solitaire&) = 0;
+    virtual std::optional<moves::Move> getHint() const = 0;
+};
+
+}
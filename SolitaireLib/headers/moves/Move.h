@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include "moves/MoveType.h"
+
+namespace solitaire::moves {
+
+class Move {
+public:
+    constexpr Move();
+    constexpr Move(const MoveType type, const unsigned source = 0,
+                   const unsigned destination = 0, const unsigned quantity = 1);
+
+    constexpr MoveType getType() const;
+    constexpr unsigned getSource() const;
+    constexpr unsigned getDestination() const;
+    constexpr unsigned getQuantity() const;
+    constexpr std::uint16_t getCode() const;
+
+    static constexpr unsigned sourceShift {3};
+    static constexpr unsigned destinationShift {7};
+    static constexpr unsigned quantityShift {11};
+    static constexpr std::uint16_t typeMask {0x07};
+    static constexpr std::uint16_t pileIdMask {0x0F};
+    static constexpr std::uint16_t quantityMask {0x1F};
+
+private:
+    std::uint16_t code;
+};
+
+constexpr Move::Move(): code {0} {
+}
+
+constexpr Move::Move(const MoveType type, const unsigned source,
+                     const unsigned destination, const unsigned quantity):
+    code {static_cast<std::uint16_t>(
+        static_cast<unsigned>(type) |
+        source << sourceShift |
+        destination << destinationShift |
+        quantity << quantityShift)} {
+}
+
+constexpr MoveType Move::getType() const {
+    return static_cast<MoveType>(code & typeMask);
+}
+
+constexpr unsigned Move::getSource() const {
+    return code >> sourceShift & pileIdMask;
+}
+
+constexpr unsigned Move::getDestination() const {
+    return code >> destinationShift & pileIdMask;
+}
+
+constexpr unsigned Move::getQuantity() const {
+    return code >> quantityShift & quantityMask;
+}
+
+constexpr std::uint16_t Move::getCode() const {
+    return code;
+}
+
+constexpr bool operator==(const Move& lhs, const Move& rhs) {
+    return lhs.getCode() == rhs.getCode();
+}
+
+constexpr bool operator!=(const Move& lhs, const Move& rhs) {
+    return not (lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const Move& move);
+
+}
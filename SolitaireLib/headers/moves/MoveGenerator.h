@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+
+#include "GameState.h"
+#include "moves/Move.h"
+
+namespace solitaire::moves {
+
+class MoveGenerator {
+public:
+    static constexpr unsigned maxMovesCount {128};
+    using Moves = std::array<Move, maxMovesCount>;
+
+    explicit MoveGenerator(const GameState&);
+
+    unsigned generate(Moves&) const;
+
+private:
+    void generateTableauPilesUncovering(Moves&, unsigned& movesCount) const;
+    void generateTableauPilesToFoundationPilesMoves(Moves&, unsigned& movesCount) const;
+    void generateStockPileToFoundationPilesMoves(Moves&, unsigned& movesCount) const;
+    void generateTableauPilesToTableauPilesMoves(Moves&, unsigned& movesCount) const;
+    void generateStockPileToTableauPilesMoves(Moves&, unsigned& movesCount) const;
+    void generateFoundationPilesToTableauPilesMoves(Moves&, unsigned& movesCount) const;
+    void generateStockPileCardSelection(Moves&, unsigned& movesCount) const;
+
+    bool isGameFinished() const;
+    bool isStockPileCardSelected() const;
+    bool isTableauPileTopCardCovered(const unsigned id) const;
+    bool canBeAddedOnTableauPile(const cards::Card&, const unsigned id) const;
+    bool canBeAddedOnFoundationPile(const cards::Card&, const unsigned id) const;
+
+    unsigned getPileSize(const unsigned index) const;
+    unsigned getTableauPileUncoveredCardsCount(const unsigned id) const;
+    const cards::Card& getPileTopCard(const unsigned index) const;
+    const cards::Card& getSelectedStockPileCard() const;
+
+    const GameState& gameState;
+    const GameState::PilesOffsets pilesOffsets;
+};
+
+}
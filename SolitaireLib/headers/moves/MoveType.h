@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+namespace solitaire::moves {
+
+enum class MoveType {
+    SelectNextStockPileCard,
+    UncoverTableauPileTopCard,
+    MoveStockPileCardToTableauPile,
+    MoveStockPileCardToFoundationPile,
+    MoveTableauPileCardsToTableauPile,
+    MoveTableauPileCardToFoundationPile,
+    MoveFoundationPileCardToTableauPile
+};
+
+constexpr int to_int(const MoveType& moveType) {
+    return static_cast<int>(moveType);
+}
+
+inline std::string to_string(const MoveType& moveType) {
+    switch(moveType) {
+        case MoveType::SelectNextStockPileCard:
+            return "SelectNextStockPileCard";
+        case MoveType::UncoverTableauPileTopCard:
+            return "UncoverTableauPileTopCard";
+        case MoveType::MoveStockPileCardToTableauPile:
+            return "MoveStockPileCardToTableauPile";
+        case MoveType::MoveStockPileCardToFoundationPile:
+            return "MoveStockPileCardToFoundationPile";
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            return "MoveTableauPileCardsToTableauPile";
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            return "MoveTableauPileCardToFoundationPile";
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            return "MoveFoundationPileCardToTableauPile";
+        default:
+            return "Unknown";
+    }
+}
+
+}
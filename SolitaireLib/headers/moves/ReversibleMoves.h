@@ -0,0 +1,11 @@
+#pragma once
+
+#include "GameState.h"
+#include "moves/Move.h"
+
+namespace solitaire::moves {
+
+void applyMove(GameState& gameState, const Move& move);
+void undoMove(GameState& gameState, const Move& move);
+
+}
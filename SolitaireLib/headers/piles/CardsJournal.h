@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "cards/Card.h"
+
+namespace solitaire::piles {
+
+class CardsJournal {
+public:
+    using Position = std::uint64_t;
+
+    struct Entry {
+        cards::Card card;
+        bool isRemoval;
+        unsigned stackIndex;
+    };
+
+    Position attachSnapshot();
+    void detachSnapshot(const Position position) noexcept;
+
+    void recordAddedCard(const cards::Card& card, const unsigned stackIndex = 0);
+    void recordRemovedCard(const cards::Card& card, const unsigned stackIndex = 0);
+
+    template <class InputIterator>
+    void recordAddedCards(InputIterator begin, const InputIterator end,
+                          const unsigned stackIndex = 0);
+    template <class InputIterator>
+    void recordRemovedCards(InputIterator begin, const InputIterator end,
+                            const unsigned stackIndex = 0);
+
+    template <class Callback>
+    void rollBack(const Position position, Callback undoEntry);
+
+    std::size_t getEntriesCount() const;
+    std::size_t getMemoryUsage() const;
+    std::size_t getMemoryUsagePinnedBy(const Position position) const;
+
+private:
+    static constexpr std::uint8_t cardCodeMask {0x3F};
+    static constexpr std::uint8_t stackIndexMask {0x40};
+    static constexpr std::uint8_t removalMask {0x80};
+    static constexpr std::size_t initialCapacity {64};
+
+    static Entry decodeEntry(const std::uint8_t entry);
+
+    bool isRecording() const;
+    void record(const cards::Card& card, const bool isRemoval, const unsigned stackIndex);
+    void growCapacity();
+    std::uint8_t popLastEntry();
+    std::size_t getEntryIndex(const std::size_t offset) const;
+    Position getEndPosition() const;
+    void throwExceptionOnPositionNotInJournal(const Position position) const;
+    void discardEntriesNotNeededBySnapshots() noexcept;
+
+    std::vector<std::uint8_t> entries;
+    std::size_t firstEntryIndex {0};
+    std::size_t entriesCount {0};
+    Position firstEntryPosition {0};
+    std::deque<Position> snapshotsPositions;
+};
+
+template <class InputIterator>
+void CardsJournal::recordAddedCards(InputIterator begin, const InputIterator end,
+                                    const unsigned stackIndex)
+{
+    if (isRecording())
+        for (; begin != end; ++begin)
+            record(*begin, false, stackIndex);
+}
+
+template <class InputIterator>
+void CardsJournal::recordRemovedCards(InputIterator begin, const InputIterator end,
+                                      const unsigned stackIndex)
+{
+    if (isRecording())
+        for (; begin != end; ++begin)
+            record(*begin, true, stackIndex);
+}
+
+template <class Callback>
+void CardsJournal::rollBack(const Position position, Callback undoEntry) {
+    throwExceptionOnPositionNotInJournal(position);
+
+    while (getEndPosition() > position)
+        undoEntry(decodeEntry(popLastEntry()));
+}
+
+}
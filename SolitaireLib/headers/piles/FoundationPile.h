@@ -2,45 +2,65 @@
 
 #include <memory>
 
+#include "archivers/SnapshotsPool.h"
 #include "interfaces/archivers/Snapshot.h"
 #include "interfaces/piles/FoundationPile.h"
+#include "piles/CardsJournal.h"
 
 namespace solitaire::piles {
 
 class FoundationPile: public std::enable_shared_from_this<FoundationPile>,
                       public interfaces::FoundationPile {
 public:
+    FoundationPile();
+    explicit FoundationPile(std::shared_ptr<archivers::SnapshotsPool>);
+
     void initialize() override;
+    void initialize(const cards::Deck::const_iterator& begin,
+                    const cards::Deck::const_iterator& end) override;
     std::unique_ptr<archivers::interfaces::Snapshot> createSnapshot() override;
 
     void tryAddCard(std::optional<cards::Card>& cardToAdd) override;
     std::optional<cards::Card> tryPullOutCard() override;
 
+    bool canAddCard(const cards::Card& cardToAdd) const override;
+    bool canPullOutCard() const override;
+
     const cards::Cards& getCards() const override;
+    cards::CardSet getCardSet() const override;
+    std::uint64_t getPositionHash() const override;
     std::optional<cards::Value> getTopCardValue() const override;
 
 private:
     class Snapshot;
 
-    bool shouldAddCard(std::optional<cards::Card>& cardToAdd) const;
     bool isCardToAddAce(const cards::Card& cardToAdd) const;
     bool isCardToAddCorrect(const cards::Card& cardToAdd) const;
 
+    std::shared_ptr<archivers::SnapshotsPool> snapshotsPool;
     cards::Cards cards;
+    cards::CardSet cardSet;
+    std::uint64_t positionHash {0};
+    CardsJournal journal;
 };
 
-class FoundationPile::Snapshot: public archivers::interfaces::Snapshot {
+class FoundationPile::Snapshot: public archivers::PooledSnapshot {
 public:
     Snapshot(std::shared_ptr<FoundationPile> foundationPile,
-             cards::Cards pileCards);
+             cards::CardSet pileCardSet, std::uint64_t positionHash);
+    ~Snapshot();
 
     void restore() const override;
     bool isSnapshotOfSameObject(
         const archivers::interfaces::Snapshot&) const override;
+    const void* getObjectKey() const override;
+    std::size_t getMemoryUsage() const override;
 
 private:
     const std::shared_ptr<FoundationPile> foundationPile;
-    const cards::Cards pileCards;
+    const CardsJournal::Position journalPosition;
+    const cards::CardSet pileCardSet;
+    const std::uint64_t positionHash;
 };
 
 }
@@ -1,47 +1,73 @@
 #pragma once
 
+#include "archivers/SnapshotsPool.h"
 #include "interfaces/archivers/Snapshot.h"
 #include "interfaces/piles/StockPile.h"
+#include "piles/CardsJournal.h"
 
 namespace solitaire::piles {
 
 class StockPile: public std::enable_shared_from_this<StockPile>,
                  public interfaces::StockPile {
 public:
+    StockPile();
+    explicit StockPile(std::shared_ptr<archivers::SnapshotsPool>);
+
     void initialize(const cards::Deck::const_iterator& begin,
                     const cards::Deck::const_iterator& end) override;
+    void initialize(const cards::Deck::const_iterator& begin,
+                    const cards::Deck::const_iterator& end,
+                    const std::optional<unsigned> selectedCardIndex) override;
 
     std::unique_ptr<archivers::interfaces::Snapshot> createSnapshot() override;
 
     void trySelectNextCard() override;
+    void trySelectPreviousCard() override;
     std::optional<cards::Card> tryPullOutCard() override;
+    void putBackCard(const cards::Card&) override;
+    bool canPullOutCard() const override;
 
     const cards::Cards& getCards() const override;
+    cards::CardSet getCardSet() const override;
+    std::uint64_t getPositionHash() const override;
     std::optional<unsigned> getSelectedCardIndex() const override;
 
 private:
     class Snapshot;
 
-    void incrementSelectedCardIndex();
-    void decrementSelectedCardIndex();
+    static constexpr unsigned stockCardsJournalIndex {0};
+    static constexpr unsigned wasteCardsJournalIndex {1};
+
+    void moveWasteCardsBackToStock();
+    void moveStockCardsBackToWaste();
+    void toggleWasteCardPositionHash(const cards::Card&);
 
-    cards::Cards cards;
-    std::optional<unsigned> selectedCardIndex;
+    std::shared_ptr<archivers::SnapshotsPool> snapshotsPool;
+    cards::Cards stockCards;
+    cards::Cards wasteCards;
+    cards::CardSet cardSet;
+    std::uint64_t positionHash {0};
+    mutable cards::Cards cards;
+    mutable bool areCardsUpToDate {true};
+    CardsJournal journal;
 };
 
-class StockPile::Snapshot: public archivers::interfaces::Snapshot {
+class StockPile::Snapshot: public archivers::PooledSnapshot {
 public:
-    Snapshot(std::shared_ptr<StockPile>, cards::Cards,
-             std::optional<unsigned> selectedCardIndex);
+    Snapshot(std::shared_ptr<StockPile>, cards::CardSet, std::uint64_t positionHash);
+    ~Snapshot();
 
     void restore() const override;
     bool isSnapshotOfSameObject(
         const archivers::interfaces::Snapshot&) const override;
+    const void* getObjectKey() const override;
+    std::size_t getMemoryUsage() const override;
 
 private:
     const std::shared_ptr<StockPile> stockPile;
-    const cards::Cards pileCards;
-    const std::optional<unsigned> selectedCardIndex;
+    const CardsJournal::Position journalPosition;
+    const cards::CardSet pileCardSet;
+    const std::uint64_t positionHash;
 };
 
 }
@@ -1,51 +1,88 @@
 #pragma once
 
+#include "archivers/SnapshotsPool.h"
 #include "interfaces/archivers/Snapshot.h"
 #include "interfaces/piles/TableauPile.h"
+#include "piles/CardsJournal.h"
 
 namespace solitaire::piles {
 
 class TableauPile: public std::enable_shared_from_this<TableauPile>,
                    public interfaces::TableauPile {
 public:
+    TableauPile();
+    explicit TableauPile(std::shared_ptr<archivers::SnapshotsPool>);
+
     void initialize(const cards::Deck::const_iterator& begin,
                     const cards::Deck::const_iterator& end) override;
+    void initialize(const cards::Deck::const_iterator& begin,
+                    const cards::Deck::const_iterator& end,
+                    const unsigned topCoveredCardPosition) override;
 
     std::unique_ptr<archivers::interfaces::Snapshot> createSnapshot() override;
 
     void tryUncoverTopCard() override;
+    void tryCoverTopCard() override;
     void tryAddCards(cards::Cards& cardsToAdd) override;
+    bool tryAddCards(cards::Cards::const_iterator firstCardToAdd,
+                     cards::Cards::const_iterator lastCardToAdd) override;
     cards::Cards tryPullOutCards(unsigned quantity) override;
+    bool tryMoveCards(unsigned quantity,
+                      interfaces::TableauPile& destinationPile) override;
+    bool tryMoveTopCard(interfaces::FoundationPile& destinationPile) override;
+    void putBackCards(cards::Cards::const_iterator firstCardToPutBack,
+                      cards::Cards::const_iterator lastCardToPutBack) override;
+
+    bool canAddCards(cards::Cards::const_iterator firstCardToAdd,
+                     cards::Cards::const_iterator lastCardToAdd) const override;
+    bool canPullOutCards(unsigned quantity) const override;
 
     const cards::Cards& getCards() const override;
+    cards::CardSet getCardSet() const override;
+    std::uint64_t getPositionHash() const override;
+    cards::CardSet getCoveredCardSet() const override;
     unsigned getTopCoveredCardPosition() const override;
     bool isTopCardCovered() const override;
 
 private:
     class Snapshot;
 
-    bool shouldAddCards(const cards::Cards& cardsToAdd) const;
     bool shouldPullOutCards(unsigned quantity) const;
-    bool isFirstCardToAddKing(const cards::Cards& cardsToAdd) const;
-    bool isFirstCardToAddCorrect(const cards::Cards& cardsToAdd) const;
+    bool isFirstCardToAddKing(const cards::Card& firstCardToAdd) const;
+    bool isFirstCardToAddCorrect(const cards::Card& firstCardToAdd) const;
+    void appendCards(cards::Cards::const_iterator firstCardToAppend,
+                     cards::Cards::const_iterator lastCardToAppend);
+    void removeTopCards(unsigned quantity);
 
+    std::shared_ptr<archivers::SnapshotsPool> snapshotsPool;
     cards::Cards cards;
+    cards::CardSet cardSet;
+    cards::CardSet coveredCardSet;
     unsigned topCoveredCardPosition {0};
+    std::uint64_t positionHash {0};
+    CardsJournal journal;
 };
 
-class TableauPile::Snapshot: public archivers::interfaces::Snapshot {
+class TableauPile::Snapshot: public archivers::PooledSnapshot {
 public:
-    Snapshot(std::shared_ptr<TableauPile>, cards::Cards,
-             unsigned topCoveredCardPosition);
+    Snapshot(std::shared_ptr<TableauPile>, cards::CardSet,
+             cards::CardSet coveredCardSet, unsigned topCoveredCardPosition,
+             std::uint64_t positionHash);
+    ~Snapshot();
 
     void restore() const override;
     bool isSnapshotOfSameObject(
         const archivers::interfaces::Snapshot&) const override;
+    const void* getObjectKey() const override;
+    std::size_t getMemoryUsage() const override;
 
 private:
     const std::shared_ptr<TableauPile> tableauPile;
-    const cards::Cards pileCards;
+    const CardsJournal::Position journalPosition;
+    const cards::CardSet pileCardSet;
+    const cards::CardSet coveredCardSet;
     const unsigned topCoveredCardPosition;
+    const std::uint64_t positionHash;
 };
 
 }
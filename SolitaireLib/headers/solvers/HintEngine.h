@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "GameState.h"
+#include "interfaces/solvers/HintEngine.h"
+#include "solvers/Solver.h"
+
+namespace solitaire::solvers {
+
+class HintEngine: public interfaces::HintEngine {
+public:
+    static constexpr SolverLimits defaultLimits {
+        1'000'000, std::chrono::milliseconds {2000}, 20
+    };
+
+    explicit HintEngine(const SolverLimits& limits = defaultLimits);
+    ~HintEngine() override;
+
+    HintEngine(const HintEngine&) = delete;
+    HintEngine& operator=(const HintEngine&) = delete;
+
+    void analyzePosition(const solitaire::interfaces::Solitaire&) override;
+    std::optional<moves::Move> getHint() const override;
+
+private:
+    void analyzePositionsInBackground();
+
+    Solver solver;
+    mutable std::mutex mutex;
+    std::condition_variable positionChanged;
+    std::optional<GameState> positionToAnalyze;
+    std::optional<moves::Move> hint;
+    bool stopped {false};
+
+    std::optional<std::uint64_t> analyzedPositionHash;
+    bool isHintVisible {false};
+    std::thread worker;
+};
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GameState.h"
+#include "cards/Deck.h"
+#include "moves/Move.h"
+#include "moves/MoveGenerator.h"
+#include "solvers/TranspositionTable.h"
+
+namespace solitaire::solvers {
+
+enum class SolverStatus {
+    Solved,
+    Unsolvable,
+    NodesLimitReached,
+    TimeLimitReached,
+    Cancelled
+};
+
+inline std::string to_string(const SolverStatus& status) {
+    switch(status) {
+        case SolverStatus::Solved:
+            return "Solved";
+        case SolverStatus::Unsolvable:
+            return "Unsolvable";
+        case SolverStatus::NodesLimitReached:
+            return "NodesLimitReached";
+        case SolverStatus::TimeLimitReached:
+            return "TimeLimitReached";
+        case SolverStatus::Cancelled:
+            return "Cancelled";
+        default:
+            return "Unknown";
+    }
+}
+
+struct SolverLimits {
+    std::uint64_t maxNodesCount {10'000'000};
+    std::chrono::milliseconds maxTime {std::chrono::milliseconds::zero()};
+    unsigned transpositionTableSizeLog2 {22};
+};
+
+struct SolverResult {
+    SolverStatus status;
+    std::vector<moves::Move> moves;
+    std::uint64_t nodesCount;
+};
+
+class Solver {
+public:
+    explicit Solver(const SolverLimits& limits = SolverLimits {});
+
+    SolverResult solve(const cards::Deck& deck);
+    SolverResult solve(const GameState& gameState);
+    SolverResult solve(const GameState& gameState, const std::uint64_t generation);
+    std::uint64_t getGeneration() const;
+    void cancel();
+
+private:
+    struct SearchNode {
+        moves::MoveGenerator::Moves moves;
+        unsigned movesCount;
+        unsigned nextMoveIndex;
+    };
+
+    void pushSearchNode(const GameState& gameState);
+    bool isLimitReached(SolverStatus& status) const;
+    std::vector<moves::Move> collectPlayedMoves() const;
+
+    static unsigned filterMoves(const GameState& gameState,
+                                moves::MoveGenerator::Moves& moves,
+                                const unsigned movesCount);
+
+    const SolverLimits limits;
+    TranspositionTable transpositionTable;
+    std::vector<SearchNode> searchNodes;
+    std::uint64_t nodesCount {0};
+    std::chrono::steady_clock::time_point startTime;
+    std::uint64_t searchGeneration {0};
+    std::atomic<std::uint64_t> generation {0};
+};
+
+}
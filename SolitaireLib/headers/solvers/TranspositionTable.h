@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace solitaire::solvers {
+
+class TranspositionTable {
+public:
+    static constexpr unsigned bucketSize {4};
+
+    explicit TranspositionTable(const unsigned sizeLog2);
+
+    bool tryInsert(const std::uint64_t hash);
+    bool contains(const std::uint64_t hash) const;
+    void clear();
+
+    std::size_t getCapacity() const;
+
+private:
+    static constexpr unsigned generationShift {56};
+    static constexpr std::uint64_t maxGeneration {0xFF};
+
+    std::uint64_t toEntry(const std::uint64_t hash) const;
+    bool isFromCurrentGeneration(const std::uint64_t entry) const;
+
+    std::size_t getBucketBegin(const std::uint64_t hash) const;
+
+    std::vector<std::uint64_t> entries;
+    const std::size_t bucketsMask;
+    std::uint64_t generation {1};
+};
+
+}
@@ -3,6 +3,7 @@
 #include "interfaces/Solitaire.h"
 #include "interfaces/events/EventsProcessor.h"
 #include "interfaces/graphics/Renderer.h"
+#include "interfaces/solvers/HintEngine.h"
 #include "interfaces/time/FPSLimiter.h"
 
 using namespace solitaire::events::interfaces;
@@ -28,6 +29,7 @@ void Application::run() const {
     while (not eventsProcessor->shouldQuit()) {
         fpsLimiter->saveFrameStartTime();
         eventsProcessor->processEvents();
+        context->getHintEngine().analyzePosition(context->getSolitaire());
         renderer->render();
         fpsLimiter->sleepRestOfFrameTime();
     }
@@ -4,12 +4,14 @@
 #include "interfaces/colliders/FoundationPileCollider.h"
 #include "interfaces/colliders/StockPileCollider.h"
 #include "interfaces/colliders/TableauPileCollider.h"
+#include "interfaces/solvers/HintEngine.h"
 #include "piles/PileId.h"
 
 using namespace solitaire::colliders::interfaces;
 using namespace solitaire::interfaces;
 using namespace solitaire::geometry;
 using namespace solitaire::piles;
+using namespace solitaire::solvers::interfaces;
 
 namespace solitaire {
 
@@ -18,13 +20,15 @@ Context::Context(std::unique_ptr<Solitaire> solitaire,
                  TableauPileColliders tableauPileColliders,
                  std::unique_ptr<StockPileCollider> stockPileCollider,
                  std::unique_ptr<Button> newGameButton,
-                 std::unique_ptr<Button> undoButton):
+                 std::unique_ptr<Button> undoButton,
+                 std::unique_ptr<HintEngine> hintEngine):
     solitaire {std::move(solitaire)},
     foundationPileColliders {std::move(foundationPileColliders)},
     tableauPileColliders {std::move(tableauPileColliders)},
     stockPileCollider {std::move(stockPileCollider)},
     newGameButton {std::move(newGameButton)},
-    undoButton {std::move(undoButton)} {
+    undoButton {std::move(undoButton)},
+    hintEngine {std::move(hintEngine)} {
 }
 
 void Context::setMousePosition(const Position& position) {
@@ -91,6 +95,14 @@ const Button& Context::getUndoButton() const {
     return *undoButton;
 }
 
+HintEngine& Context::getHintEngine() {
+    return *hintEngine;
+}
+
+const HintEngine& Context::getHintEngine() const {
+    return *hintEngine;
+}
+
 Position Context::getMousePosition() const {
     return mousePosition;
 }
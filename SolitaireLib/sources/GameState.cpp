@@ -0,0 +1,115 @@
+#include <cstring>
+
+#include "GameState.h"
+#include "cards/ZobristKeys.h"
+
+using namespace solitaire::cards;
+
+namespace solitaire {
+
+namespace {
+constexpr std::uint64_t hashMultiplier {0x9E3779B97F4A7C15};
+
+constexpr std::uint64_t mixHash(const std::uint64_t hash, const std::uint64_t word) {
+    const auto mixed = (hash ^ word) * hashMultiplier;
+    return mixed ^ (mixed >> 29);
+}
+}
+
+GameState GameState::fromDeck(const cards::Deck& deck) {
+    GameState gameState;
+    gameState.cards = deck;
+
+    for (unsigned id = 0; id < gameState.tableauPilesSizes.size(); ++id) {
+        gameState.tableauPilesSizes[id] = id + 1;
+        gameState.tableauPilesTopCoveredCardPositions[id] = id;
+    }
+
+    gameState.foundationPilesSizes.fill(0);
+    gameState.stockPileSelectedCardIndex = noSelectedStockPileCard;
+    return gameState;
+}
+
+GameState::PilesOffsets GameState::getPilesOffsets() const {
+    PilesOffsets offsets;
+    offsets[0] = 0;
+
+    for (unsigned id = 0; id < tableauPilesSizes.size(); ++id)
+        offsets[id + 1] = offsets[id] + tableauPilesSizes[id];
+
+    for (unsigned id = 0; id < foundationPilesSizes.size(); ++id)
+        offsets[firstFoundationPileIndex + id + 1] =
+            offsets[firstFoundationPileIndex + id] + foundationPilesSizes[id];
+
+    offsets[pilesCount] = cards.size();
+    return offsets;
+}
+
+std::uint64_t GameState::getPositionHash() const {
+    const auto offsets = getPilesOffsets();
+    const auto getCardsHash = [this](const unsigned begin, const unsigned end,
+                                     const CardLocation location) {
+        return getZobristHash(std::next(cards.begin(), begin),
+                              std::next(cards.begin(), end), location);
+    };
+    std::uint64_t hash = 0;
+
+    for (unsigned id = 0; id < tableauPilesSizes.size(); ++id) {
+        const auto firstUncoveredCard = offsets[id] + tableauPilesTopCoveredCardPositions[id];
+        const auto pileHash =
+            getCardsHash(offsets[id], firstUncoveredCard,
+                         CardLocation::TableauPileCovered) ^
+            getCardsHash(firstUncoveredCard, offsets[id + 1],
+                         CardLocation::TableauPileUncovered);
+        hash ^= placeZobristHashOnPile(pileHash, id);
+    }
+
+    for (unsigned id = 0; id < foundationPilesSizes.size(); ++id) {
+        const auto pileIndex = firstFoundationPileIndex + id;
+        hash ^= placeZobristHashOnPile(
+            getCardsHash(offsets[pileIndex], offsets[pileIndex + 1],
+                         CardLocation::FoundationPile),
+            pileIndex);
+    }
+
+    const auto firstStockCard = stockPileSelectedCardIndex == noSelectedStockPileCard ?
+        offsets[stockPileIndex] : offsets[stockPileIndex] + stockPileSelectedCardIndex + 1u;
+    const auto stockPileHash =
+        getCardsHash(offsets[stockPileIndex], firstStockCard,
+                     CardLocation::StockPileWaste) ^
+        getCardsHash(firstStockCard, offsets[pilesCount],
+                     CardLocation::StockPileStock);
+    return hash ^ placeZobristHashOnPile(stockPileHash, stockPileIndex);
+}
+
+bool operator==(const GameState& lhs, const GameState& rhs) {
+    return std::memcmp(&lhs, &rhs, sizeof(GameState)) == 0;
+}
+
+bool operator!=(const GameState& lhs, const GameState& rhs) {
+    return not (lhs == rhs);
+}
+
+}
+
+namespace std {
+
+size_t hash<solitaire::GameState>::operator()(const solitaire::GameState& gameState) const {
+    const auto bytes = reinterpret_cast<const unsigned char*>(&gameState);
+    std::uint64_t hash {sizeof(solitaire::GameState)};
+    std::size_t offset = 0;
+
+    for (; offset + sizeof(std::uint64_t) <= sizeof(solitaire::GameState);
+         offset += sizeof(std::uint64_t))
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        hash = solitaire::mixHash(hash, word);
+    }
+
+    std::uint64_t tail {0};
+    std::memcpy(&tail, bytes + offset, sizeof(solitaire::GameState) - offset);
+    return solitaire::mixHash(hash, tail);
+}
+
+}
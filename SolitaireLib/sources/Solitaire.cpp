@@ -1,8 +1,13 @@
 #include <algorithm>
+#include <numeric>
 #include <string>
 
+#include "GameState.h"
 #include "Solitaire.h"
-#include "cards/Value.h"
+#include "archivers/CompositeSnapshot.h"
+#include "cards/CardPlacementRules.h"
+#include "cards/CardSet.h"
+#include "cards/ZobristKeys.h"
 #include "interfaces/archivers/HistoryTracker.h"
 #include "interfaces/archivers/MoveCardsOperationSnapshotCreator.h"
 #include "interfaces/archivers/Snapshot.h"
@@ -10,37 +15,157 @@
 #include "interfaces/piles/FoundationPile.h"
 #include "interfaces/piles/StockPile.h"
 #include "interfaces/piles/TableauPile.h"
+#include "moves/Move.h"
+#include "moves/MoveGenerator.h"
+#include "moves/ReversibleMoves.h"
 #include "piles/PileId.h"
 
+using namespace solitaire::archivers;
 using namespace solitaire::archivers::interfaces;
 using namespace solitaire::cards;
 using namespace solitaire::cards::interfaces;
+using namespace solitaire::moves;
 using namespace solitaire::piles;
 using namespace solitaire::piles::interfaces;
 
 namespace solitaire {
 
+namespace {
+constexpr unsigned getFoundationPileIndex(const unsigned id) {
+    return GameState::firstFoundationPileIndex + id;
+}
+
+MoveRecord createMoveRecord(const Move& move) {
+    const auto source = move.getSource();
+    const auto destination = move.getDestination();
+
+    switch (move.getType()) {
+        case MoveType::SelectNextStockPileCard:
+            return MoveRecord {MoveRecord::Type::SelectNextStockPileCard,
+                               GameState::stockPileIndex, GameState::stockPileIndex};
+        case MoveType::UncoverTableauPileTopCard:
+            return MoveRecord {MoveRecord::Type::UncoverTableauPileTopCard, source, source};
+        case MoveType::MoveStockPileCardToTableauPile:
+            return MoveRecord {MoveRecord::Type::MoveCards,
+                               GameState::stockPileIndex, destination, 1};
+        case MoveType::MoveStockPileCardToFoundationPile:
+            return MoveRecord {MoveRecord::Type::MoveCards, GameState::stockPileIndex,
+                               getFoundationPileIndex(destination), 1};
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            return MoveRecord {MoveRecord::Type::MoveCards,
+                               source, destination, move.getQuantity()};
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            return MoveRecord {MoveRecord::Type::MoveCards,
+                               source, getFoundationPileIndex(destination), 1};
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            return MoveRecord {MoveRecord::Type::MoveCards,
+                               getFoundationPileIndex(source), destination, 1};
+    }
+    throw std::runtime_error {
+        "Cannot create record of move with type: " + to_string(move.getType())
+    };
+}
+
+bool isGameStateFinished(const GameState& gameState) {
+    const auto& sizes = gameState.foundationPilesSizes;
+    return std::accumulate(sizes.begin(), sizes.end(), 0u) == gameState.cards.size();
+}
+
+std::optional<Move> findAutoCompleteMove(const GameState& gameState) {
+    MoveGenerator::Moves moves;
+    const auto movesEnd =
+        std::next(moves.begin(), MoveGenerator {gameState}.generate(moves));
+    const auto findMove = [&](const auto predicate) -> std::optional<Move> {
+        const auto move = std::find_if(moves.begin(), movesEnd, predicate);
+        return move == movesEnd ? std::nullopt : std::optional<Move> {*move};
+    };
+
+    const auto moveToFoundationPile = findMove([](const auto& move) {
+        return move.getType() == MoveType::MoveTableauPileCardToFoundationPile or
+               move.getType() == MoveType::MoveStockPileCardToFoundationPile;
+    });
+    if (moveToFoundationPile)
+        return moveToFoundationPile;
+
+    return findMove([](const auto& move) {
+        return move.getType() == MoveType::SelectNextStockPileCard;
+    });
+}
+
+bool areGameStatePilesSizesValid(const GameState& gameState) {
+    const auto& tableauSizes = gameState.tableauPilesSizes;
+    const auto& foundationSizes = gameState.foundationPilesSizes;
+    const auto pilesCardsCount =
+        std::accumulate(tableauSizes.begin(), tableauSizes.end(), 0u) +
+        std::accumulate(foundationSizes.begin(), foundationSizes.end(), 0u);
+    if (pilesCardsCount > gameState.cards.size())
+        return false;
+
+    for (unsigned id = 0; id < tableauSizes.size(); ++id)
+        if (tableauSizes[id] > Cards::capacity or
+            gameState.tableauPilesTopCoveredCardPositions[id] > tableauSizes[id])
+            return false;
+
+    const auto stockPileCardsCount = gameState.cards.size() - pilesCardsCount;
+    const auto selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    return stockPileCardsCount <= Cards::capacity and
+        (selectedCardIndex == GameState::noSelectedStockPileCard or
+         selectedCardIndex < stockPileCardsCount);
+}
+
+bool isGameStateFoundationPileValid(const Deck::const_iterator firstCard,
+                                    const Deck::const_iterator lastCard)
+{
+    return firstCard == lastCard or (canBePlacedOnEmptyFoundation(*firstCard) and
+        std::adjacent_find(firstCard, lastCard, [](const auto& card, const auto& nextCard) {
+            return not canFollowOnFoundation(nextCard, card);
+        }) == lastCard);
+}
+
+bool areGameStatePilesCardsValid(const GameState& gameState) {
+    const CardSet cardSet {gameState.cards.begin(), gameState.cards.end()};
+    if (cardSet != CardSet::allCards())
+        return false;
+
+    const auto offsets = gameState.getPilesOffsets();
+    const auto getCard = [&gameState](const unsigned offset) {
+        return std::next(gameState.cards.begin(), offset);
+    };
+
+    for (auto index = GameState::firstFoundationPileIndex;
+         index < GameState::stockPileIndex; ++index)
+        if (not isGameStateFoundationPileValid(getCard(offsets[index]),
+                                               getCard(offsets[index + 1])))
+            return false;
+    return true;
+}
+}
+
 Solitaire::Solitaire(std::unique_ptr<DeckGenerator> deckGenerator,
                      std::shared_ptr<StockPile> stockPile,
                      FoundationPiles foundationPiles,
                      TableauPiles tableauPiles,
                      std::unique_ptr<HistoryTracker> historyTracker,
                      std::unique_ptr<MoveCardsOperationSnapshotCreator>
-                         moveCardsOperationSnapshotCreator):
+                         moveCardsOperationSnapshotCreator,
+                     std::unique_ptr<MoveRecordsHistoryTracker> moveRecordsHistoryTracker):
     deckGenerator {std::move(deckGenerator)},
     stockPile {std::move(stockPile)},
     foundationPiles {std::move(foundationPiles)},
     tableauPiles {std::move(tableauPiles)},
     historyTracker {std::move(historyTracker)},
-    moveCardsOperationSnapshotCreator {std::move(moveCardsOperationSnapshotCreator)} {
+    moveCardsOperationSnapshotCreator {std::move(moveCardsOperationSnapshotCreator)},
+    moveRecordsHistoryTracker {std::move(moveRecordsHistoryTracker)} {
 }
 
 void Solitaire::startNewGame() {
-    historyTracker->reset();
-    cardsInHand.clear();
+    throwExceptionOnTransactionInProgress("start new game");
+    resetHistory();
+    clearHand();
     const auto deck = deckGenerator->generate();
 
     initializeFoundationPiles();
+    foundationPilesCardsCount = 0;
     const auto firstNotUsedCard = initializeTableauPilesAndReturnFirstNotUsedCard(deck);
     stockPile->initialize(firstNotUsedCard, deck.end());
 }
@@ -50,6 +175,70 @@ void Solitaire::initializeFoundationPiles() {
         pile->initialize();
 }
 
+GameState Solitaire::exportGameState() const {
+    throwExceptionOnCardsInHand();
+
+    GameState gameState;
+    auto nextCard = gameState.cards.begin();
+
+    for (unsigned id = 0; id < tableauPilesCount; ++id) {
+        const auto& pile = *tableauPiles[id];
+        nextCard = std::copy(pile.getCards().begin(), pile.getCards().end(), nextCard);
+        gameState.tableauPilesSizes[id] = pile.getCards().size();
+        gameState.tableauPilesTopCoveredCardPositions[id] = pile.getTopCoveredCardPosition();
+    }
+
+    for (unsigned id = 0; id < foundationPilesCount; ++id) {
+        const auto& pileCards = foundationPiles[id]->getCards();
+        nextCard = std::copy(pileCards.begin(), pileCards.end(), nextCard);
+        gameState.foundationPilesSizes[id] = pileCards.size();
+    }
+
+    const auto& stockPileCards = stockPile->getCards();
+    std::copy(stockPileCards.begin(), stockPileCards.end(), nextCard);
+    gameState.stockPileSelectedCardIndex =
+        stockPile->getSelectedCardIndex().value_or(GameState::noSelectedStockPileCard);
+
+    return gameState;
+}
+
+void Solitaire::importGameState(const GameState& gameState) {
+    throwExceptionOnTransactionInProgress("import game state");
+    throwExceptionOnInvalidGameState(gameState);
+
+    if (not cardsInHand.empty()) {
+        moveCardsOperationSnapshotCreator->restoreSourcePile();
+        clearHand();
+    }
+
+    resetHistory();
+    initializePilesFromGameState(gameState);
+    const auto& sizes = gameState.foundationPilesSizes;
+    foundationPilesCardsCount = std::accumulate(sizes.begin(), sizes.end(), 0u);
+}
+
+void Solitaire::initializePilesFromGameState(const GameState& gameState) {
+    auto firstPileCard = gameState.cards.begin();
+
+    for (unsigned id = 0; id < tableauPilesCount; ++id) {
+        const auto lastPileCard = std::next(firstPileCard, gameState.tableauPilesSizes[id]);
+        tableauPiles[id]->initialize(firstPileCard, lastPileCard,
+                                     gameState.tableauPilesTopCoveredCardPositions[id]);
+        firstPileCard = lastPileCard;
+    }
+
+    for (unsigned id = 0; id < foundationPilesCount; ++id) {
+        const auto lastPileCard = std::next(firstPileCard, gameState.foundationPilesSizes[id]);
+        foundationPiles[id]->initialize(firstPileCard, lastPileCard);
+        firstPileCard = lastPileCard;
+    }
+
+    const auto selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    stockPile->initialize(firstPileCard, gameState.cards.end(),
+        selectedCardIndex == GameState::noSelectedStockPileCard ?
+            std::nullopt : std::optional<unsigned> {selectedCardIndex});
+}
+
 Deck::const_iterator
 Solitaire::initializeTableauPilesAndReturnFirstNotUsedCard(const Deck& deck) {
     auto firstNotUsedCard = deck.begin();
@@ -65,53 +254,169 @@ Solitaire::initializeTableauPilesAndReturnFirstNotUsedCard(const Deck& deck) {
 }
 
 void Solitaire::tryUndoOperation() {
-    if (shouldUndoOperation())
+    if (not shouldUndoOperation())
+        return;
+
+    if (moveRecordsHistoryTracker) {
+        const auto records = moveRecordsHistoryTracker->undo();
+        for (auto record = records.rbegin(); record != records.rend(); ++record)
+            undoMoveRecord(*record);
+    }
+    else
         historyTracker->undo();
+
+    countFoundationPilesCards();
 }
 
 bool Solitaire::shouldUndoOperation() const {
-    return isGameInProgressAndHandIsEmpty() and historyTracker->getHistorySize() > 0;
+    return isGameInProgressAndIdle() and getHistorySize() > 0;
+}
+
+void Solitaire::tryRedoOperation() {
+    if (shouldRedoOperation()) {
+        for (const auto& record: moveRecordsHistoryTracker->redo())
+            redoMoveRecord(record);
+        countFoundationPilesCards();
+    }
+}
+
+bool Solitaire::shouldRedoOperation() const {
+    return isGameInProgressAndIdle() and moveRecordsHistoryTracker and
+        moveRecordsHistoryTracker->getRedoSize() > 0;
+}
+
+void Solitaire::resetHistory() {
+    historyTracker->reset();
+    if (moveRecordsHistoryTracker)
+        moveRecordsHistoryTracker->reset();
+}
+
+unsigned Solitaire::getHistorySize() const {
+    if (moveRecordsHistoryTracker)
+        return moveRecordsHistoryTracker->getHistorySize();
+    return historyTracker->getHistorySize();
+}
+
+void Solitaire::saveHistory(SnapshotPtr snapshot, const MoveRecord& record) {
+    if (moveRecordsHistoryTracker)
+        moveRecordsHistoryTracker->save(record);
+    else
+        historyTracker->save(std::move(snapshot));
+}
+
+void Solitaire::undoMoveRecord(const MoveRecord& record) {
+    switch (record.type) {
+        case MoveRecord::Type::MoveCards:
+            moveCardsBetweenPiles(record.destinationPileIndex, record.sourcePileIndex,
+                                  record.cardsCount);
+            break;
+        case MoveRecord::Type::UncoverTableauPileTopCard:
+            tableauPiles[record.sourcePileIndex]->tryCoverTopCard();
+            break;
+        case MoveRecord::Type::SelectNextStockPileCard:
+            stockPile->trySelectPreviousCard();
+            break;
+    }
+}
+
+void Solitaire::redoMoveRecord(const MoveRecord& record) {
+    switch (record.type) {
+        case MoveRecord::Type::MoveCards:
+            moveCardsBetweenPiles(record.sourcePileIndex, record.destinationPileIndex,
+                                  record.cardsCount);
+            break;
+        case MoveRecord::Type::UncoverTableauPileTopCard:
+            tableauPiles[record.sourcePileIndex]->tryUncoverTopCard();
+            break;
+        case MoveRecord::Type::SelectNextStockPileCard:
+            stockPile->trySelectNextCard();
+            break;
+    }
+}
+
+void Solitaire::moveCardsBetweenPiles(const unsigned sourcePileIndex,
+                                      const unsigned destinationPileIndex,
+                                      const unsigned quantity)
+{
+    putBackCardsOnPile(destinationPileIndex, pullOutCardsFromPile(sourcePileIndex, quantity));
+}
+
+Cards Solitaire::pullOutCardsFromPile(const unsigned pileIndex, const unsigned quantity) {
+    if (pileIndex < tableauPilesCount)
+        return tableauPiles[pileIndex]->tryPullOutCards(quantity);
+
+    const auto card = pileIndex == GameState::stockPileIndex ?
+        stockPile->tryPullOutCard() :
+        foundationPiles[pileIndex - GameState::firstFoundationPileIndex]->tryPullOutCard();
+    return card ? Cards {card.value()} : Cards {};
+}
+
+void Solitaire::putBackCardsOnPile(const unsigned pileIndex, const Cards& cards) {
+    if (pileIndex < tableauPilesCount)
+        tableauPiles[pileIndex]->putBackCards(cards.begin(), cards.end());
+    else if (pileIndex == GameState::stockPileIndex)
+        for (const auto& card: cards)
+            stockPile->putBackCard(card);
+    else
+        for (const auto& card: cards) {
+            std::optional<Card> cardToPutBack {card};
+            foundationPiles[pileIndex - GameState::firstFoundationPileIndex]->tryAddCard(
+                cardToPutBack);
+        }
 }
 
 void Solitaire::tryPutCardsBackFromHand() {
     if (isGameInProgressAndHandContainsCards()) {
         moveCardsOperationSnapshotCreator->restoreSourcePile();
-        cardsInHand.clear();
+        clearHand();
+        countFoundationPilesCards();
     }
 }
 
 void Solitaire::tryPullOutCardFromFoundationPile(const PileId id) {
     throwExceptionOnInvalidFoundationPileId(id);
-    if (isGameInProgressAndHandIsEmpty()) {
-        auto& pile = foundationPiles[id];
+    auto& pile = foundationPiles[id];
+
+    if (isGameInProgressAndIdle() and pile->canPullOutCard()) {
         auto snapshot = pile->createSnapshot();
-        tryAddPulledOutCardToHand(pile->tryPullOutCard(), std::move(snapshot));
+        --foundationPilesCardsCount;
+        tryAddPulledOutCardToHand(pile->tryPullOutCard(), std::move(snapshot),
+                                  getFoundationPileIndex(id));
     }
 }
 
 void Solitaire::tryAddCardOnFoundationPile(const PileId id) {
     throwExceptionOnInvalidFoundationPileId(id);
     if (shouldAddCardOnFoundationPile())
-        tryAddCardOnFoundationPileFromHand(foundationPiles[id]);
+        tryAddCardOnFoundationPileFromHand(id);
 }
 
 bool Solitaire::shouldAddCardOnFoundationPile() const {
-    return not isGameFinished() and cardsInHand.size() == 1;
+    return not isTransactionInProgress and not isGameFinished() and cardsInHand.size() == 1;
 }
 
-void Solitaire::tryAddCardOnFoundationPileFromHand(std::shared_ptr<FoundationPile>& pile) {
-    auto snapshot = pile->createSnapshot();
-    std::optional<Card> cardToAdd {cardsInHand.back()};
-    pile->tryAddCard(cardToAdd);
-    saveHistoryIfCardMovedToOtherPileAndClearHand(cardToAdd, std::move(snapshot));
+void Solitaire::tryAddCardOnFoundationPileFromHand(const PileId id) {
+    auto& pile = foundationPiles[id];
+
+    if (pile->canAddCard(cardsInHand.back())) {
+        auto snapshot = pile->createSnapshot();
+        std::optional<Card> cardToAdd {cardsInHand.back()};
+        pile->tryAddCard(cardToAdd);
+        saveHistoryIfCardMovedToOtherPileAndClearHand(
+            cardToAdd, std::move(snapshot),
+            MoveRecord {MoveRecord::Type::MoveCards,
+                        handSourcePileIndex, getFoundationPileIndex(id), 1});
+    }
 }
 
 void Solitaire::saveHistoryIfCardMovedToOtherPileAndClearHand(
-    const std::optional<Card>& cardToAdd, SnapshotPtr destinationPileSnapshot)
+    const std::optional<Card>& cardToAdd, SnapshotPtr destinationPileSnapshot,
+    const MoveRecord& record)
 {
     if (isCardAdded(cardToAdd)) {
-        saveHistoryIfCardMovedToOtherPile(std::move(destinationPileSnapshot));
-        cardsInHand.clear();
+        ++foundationPilesCardsCount;
+        saveHistoryIfCardMovedToOtherPile(std::move(destinationPileSnapshot), record);
+        clearHand();
     }
 }
 
@@ -126,97 +431,441 @@ void Solitaire::tryUncoverTableauPileTopCard(const PileId id) {
     if (shouldUncoverTableauPileTopCard(pile)) {
         auto snapshot = pile->createSnapshot();
         pile->tryUncoverTopCard();
-        historyTracker->save(std::move(snapshot));
+        saveHistory(std::move(snapshot),
+                    MoveRecord {MoveRecord::Type::UncoverTableauPileTopCard, id, id});
     }
 }
 
 bool Solitaire::shouldUncoverTableauPileTopCard(
     const std::shared_ptr<TableauPile>& pile) const
 {
-    return isGameInProgressAndHandIsEmpty() and pile->isTopCardCovered();
+    return isGameInProgressAndIdle() and pile->isTopCardCovered();
 }
 
 void Solitaire::tryPullOutCardsFromTableauPile(const PileId id, const unsigned quantity) {
     throwExceptionOnInvalidTableauPileId(id);
-    if (isGameInProgressAndHandIsEmpty()) {
-        auto& pile = tableauPiles[id];
+    auto& pile = tableauPiles[id];
+
+    if (isGameInProgressAndIdle() and pile->canPullOutCards(quantity)) {
         auto snapshot = pile->createSnapshot();
-        tryAddPulledOutCardsToHand(pile->tryPullOutCards(quantity), std::move(snapshot));
+        tryAddPulledOutCardsToHand(pile->tryPullOutCards(quantity), std::move(snapshot), id);
     }
 }
 
-void Solitaire::tryAddPulledOutCardsToHand(cards::Cards&& cards, SnapshotPtr snapshot) {
+void Solitaire::tryAddPulledOutCardsToHand(
+    cards::Cards&& cards, SnapshotPtr snapshot, const unsigned sourcePileIndex)
+{
     if (not cards.empty()) {
         moveCardsOperationSnapshotCreator->saveSourcePileSnapshot(std::move(snapshot));
+        handSourcePileIndex = sourcePileIndex;
         cardsInHand = std::move(cards);
+        cardSetInHand = CardSet {cardsInHand.begin(), cardsInHand.end()};
     }
 }
 
 void Solitaire::tryAddCardsOnTableauPile(const PileId id) {
     throwExceptionOnInvalidTableauPileId(id);
     if (isGameInProgressAndHandContainsCards())
-        tryAddCardOnTableauPileFromHand(tableauPiles[id]);
+        tryAddCardOnTableauPileFromHand(id);
 }
 
 bool Solitaire::isGameInProgressAndHandContainsCards() const {
-    return not isGameFinished() and not cardsInHand.empty();
+    return not isTransactionInProgress and not isGameFinished() and not cardsInHand.empty();
 }
 
-void Solitaire::tryAddCardOnTableauPileFromHand(std::shared_ptr<TableauPile>& pile) {
+void Solitaire::tryAddCardOnTableauPileFromHand(const PileId id) {
+    auto& pile = tableauPiles[id];
+    if (not pile->canAddCards(cardsInHand.begin(), cardsInHand.end()))
+        return;
+
+    const MoveRecord record {MoveRecord::Type::MoveCards, handSourcePileIndex, id,
+                             static_cast<unsigned>(cardsInHand.size())};
     auto snapshot = pile->createSnapshot();
     pile->tryAddCards(cardsInHand);
 
-    if (cardsInHand.empty())
-        saveHistoryIfCardMovedToOtherPile(std::move(snapshot));
+    if (cardsInHand.empty()) {
+        cardSetInHand = CardSet {};
+        saveHistoryIfCardMovedToOtherPile(std::move(snapshot), record);
+    }
+}
+
+void Solitaire::tryMoveCardsBetweenTableauPiles(
+    const PileId sourceId, const unsigned quantity, const PileId destinationId)
+{
+    throwExceptionOnInvalidTableauPileId(sourceId);
+    throwExceptionOnInvalidTableauPileId(destinationId);
+
+    auto& source = tableauPiles[sourceId];
+    auto& destination = tableauPiles[destinationId];
+
+    if (isGameInProgressAndIdle() and sourceId != destinationId and
+        canMoveCardsBetweenTableauPiles(*source, quantity, *destination))
+    {
+        auto sourceSnapshot = source->createSnapshot();
+        auto destinationSnapshot = destination->createSnapshot();
+
+        if (source->tryMoveCards(quantity, *destination))
+            saveHistoryOfMoveBetweenPiles(
+                std::move(sourceSnapshot), std::move(destinationSnapshot),
+                MoveRecord {MoveRecord::Type::MoveCards,
+                            sourceId, destinationId, quantity});
+    }
+}
+
+void Solitaire::tryMoveCardFromTableauPileToFoundationPile(
+    const PileId sourceId, const PileId destinationId)
+{
+    throwExceptionOnInvalidTableauPileId(sourceId);
+    throwExceptionOnInvalidFoundationPileId(destinationId);
+
+    auto& source = tableauPiles[sourceId];
+    auto& destination = foundationPiles[destinationId];
+
+    if (isGameInProgressAndIdle() and
+        canMoveCardFromTableauPileToFoundationPile(*source, *destination))
+    {
+        auto sourceSnapshot = source->createSnapshot();
+        auto destinationSnapshot = destination->createSnapshot();
+
+        if (source->tryMoveTopCard(*destination)) {
+            ++foundationPilesCardsCount;
+            saveHistoryOfMoveBetweenPiles(
+                std::move(sourceSnapshot), std::move(destinationSnapshot),
+                MoveRecord {MoveRecord::Type::MoveCards,
+                            sourceId, getFoundationPileIndex(destinationId), 1});
+        }
+    }
+}
+
+bool Solitaire::canMoveCardsBetweenTableauPiles(
+    const TableauPile& source, const unsigned quantity, const TableauPile& destination) const
+{
+    if (not source.canPullOutCards(quantity))
+        return false;
+
+    const auto& sourceCards = source.getCards();
+    return destination.canAddCards(std::prev(sourceCards.end(), quantity), sourceCards.end());
 }
 
-void Solitaire::saveHistoryIfCardMovedToOtherPile(SnapshotPtr destinationPileSnapshot) {
+bool Solitaire::canMoveCardFromTableauPileToFoundationPile(
+    const TableauPile& source, const FoundationPile& destination) const
+{
+    return source.canPullOutCards(1) and destination.canAddCard(source.getCards().back());
+}
+
+void Solitaire::saveHistoryOfMoveBetweenPiles(
+    SnapshotPtr sourcePileSnapshot, SnapshotPtr destinationPileSnapshot,
+    const MoveRecord& record)
+{
+    moveCardsOperationSnapshotCreator->saveSourcePileSnapshot(std::move(sourcePileSnapshot));
+    saveHistoryIfCardMovedToOtherPile(std::move(destinationPileSnapshot), record);
+}
+
+void Solitaire::saveHistoryIfCardMovedToOtherPile(
+    SnapshotPtr destinationPileSnapshot, const MoveRecord& record)
+{
     auto moveCardsOperationSnapshot =
         moveCardsOperationSnapshotCreator->createSnapshotIfCardsMovedToOtherPile(
             std::move(destinationPileSnapshot));
 
     if (moveCardsOperationSnapshot)
-        historyTracker->save(std::move(moveCardsOperationSnapshot));
+        saveHistory(std::move(moveCardsOperationSnapshot), record);
+}
+
+void Solitaire::clearHand() {
+    cardsInHand.clear();
+    cardSetInHand = CardSet {};
+}
+
+void Solitaire::countFoundationPilesCards() {
+    foundationPilesCardsCount = 0;
+    for (const auto& pile: foundationPiles)
+        foundationPilesCardsCount += pile->getCards().size();
 }
 
 void Solitaire::trySelectNextStockPileCard() {
     if (shouldSelectNextStockPileCard()) {
         auto snapshot = stockPile->createSnapshot();
         stockPile->trySelectNextCard();
-        historyTracker->save(std::move(snapshot));
+        saveHistory(std::move(snapshot),
+                    MoveRecord {MoveRecord::Type::SelectNextStockPileCard,
+                                GameState::stockPileIndex, GameState::stockPileIndex});
     }
 }
 
 bool Solitaire::shouldSelectNextStockPileCard() const {
-    return isGameInProgressAndHandIsEmpty() and not stockPile->getCards().empty();
+    return isGameInProgressAndIdle() and not stockPile->getCardSet().empty();
 }
 
 void Solitaire::tryPullOutCardFromStockPile() {
-    if (isGameInProgressAndHandIsEmpty()) {
+    if (isGameInProgressAndIdle() and stockPile->canPullOutCard()) {
         auto snapshot = stockPile->createSnapshot();
-        tryAddPulledOutCardToHand(stockPile->tryPullOutCard(), std::move(snapshot));
+        tryAddPulledOutCardToHand(stockPile->tryPullOutCard(), std::move(snapshot),
+                                  GameState::stockPileIndex);
+    }
+}
+
+bool Solitaire::canAutoComplete() const {
+    return isGameInProgressAndIdle() and
+        std::all_of(tableauPiles.begin(), tableauPiles.end(), [](const auto& pile) {
+            return pile->getTopCoveredCardPosition() == 0;
+        });
+}
+
+std::vector<Move> Solitaire::getAutoCompleteMoves() const {
+    if (not canAutoComplete())
+        return {};
+
+    auto gameState = exportGameState();
+    const auto offsets = gameState.getPilesOffsets();
+    const unsigned stockPileCardsCount =
+        gameState.cards.size() - offsets[GameState::stockPileIndex];
+    std::vector<Move> autoCompleteMoves;
+    unsigned stockPileCardsSelectionsCount = 0;
+
+    while (not isGameStateFinished(gameState)) {
+        const auto move = findAutoCompleteMove(gameState);
+        if (not move)
+            return {};
+
+        if (move->getType() != MoveType::SelectNextStockPileCard)
+            stockPileCardsSelectionsCount = 0;
+        else if (++stockPileCardsSelectionsCount > stockPileCardsCount + 1)
+            return {};
+
+        applyMove(gameState, move.value());
+        autoCompleteMoves.push_back(move.value());
+    }
+    return autoCompleteMoves;
+}
+
+void Solitaire::tryAutoComplete() {
+    const auto moves = getAutoCompleteMoves();
+    if (moves.empty())
+        return;
+
+    beginTransaction();
+    for (const auto& move: moves)
+        if (not tryApplyMove(move)) {
+            abortTransaction();
+            return;
+        }
+    endTransaction();
+    resetHistory();
+}
+
+void Solitaire::beginTransaction() {
+    throwExceptionIfTransactionCannotBegin();
+    isTransactionInProgress = true;
+}
+
+bool Solitaire::tryApplyMove(const Move& move) {
+    throwExceptionOnNoTransactionInProgress();
+    if (isGameFinished() or not tryApplyMoveOnPiles(move))
+        return false;
+
+    if (moveRecordsHistoryTracker)
+        transactionMoveRecords.push_back(createMoveRecord(move));
+    return true;
+}
+
+bool Solitaire::tryApplyMoveOnPiles(const Move& move) {
+    const PileId source {move.getSource()};
+    const PileId destination {move.getDestination()};
+
+    switch (move.getType()) {
+        case MoveType::SelectNextStockPileCard:
+            if (stockPile->getCardSet().empty())
+                return false;
+            saveTransactionSnapshotOnce(GameState::stockPileIndex, *stockPile);
+            stockPile->trySelectNextCard();
+            return true;
+        case MoveType::UncoverTableauPileTopCard:
+            throwExceptionOnInvalidTableauPileId(source);
+            if (not tableauPiles[source]->isTopCardCovered())
+                return false;
+            saveTransactionSnapshotOnce(source, *tableauPiles[source]);
+            tableauPiles[source]->tryUncoverTopCard();
+            return true;
+        case MoveType::MoveStockPileCardToTableauPile:
+            return tryMoveStockPileCardToTableauPile(destination);
+        case MoveType::MoveStockPileCardToFoundationPile:
+            return tryMoveStockPileCardToFoundationPile(destination);
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            throwExceptionOnInvalidTableauPileId(source);
+            throwExceptionOnInvalidTableauPileId(destination);
+            if (source == destination or not canMoveCardsBetweenTableauPiles(
+                    *tableauPiles[source], move.getQuantity(), *tableauPiles[destination]))
+                return false;
+            saveTransactionSnapshotOnce(source, *tableauPiles[source]);
+            saveTransactionSnapshotOnce(destination, *tableauPiles[destination]);
+            return tableauPiles[source]->tryMoveCards(
+                move.getQuantity(), *tableauPiles[destination]);
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            throwExceptionOnInvalidTableauPileId(source);
+            throwExceptionOnInvalidFoundationPileId(destination);
+            if (not canMoveCardFromTableauPileToFoundationPile(
+                    *tableauPiles[source], *foundationPiles[destination]))
+                return false;
+            saveTransactionSnapshotOnce(source, *tableauPiles[source]);
+            saveTransactionSnapshotOnce(GameState::firstFoundationPileIndex + destination,
+                                        *foundationPiles[destination]);
+            tableauPiles[source]->tryMoveTopCard(*foundationPiles[destination]);
+            ++foundationPilesCardsCount;
+            return true;
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            return tryMoveFoundationPileCardToTableauPile(source, destination);
+    }
+    return false;
+}
+
+bool Solitaire::tryMoveStockPileCardToTableauPile(const PileId destination) {
+    throwExceptionOnInvalidTableauPileId(destination);
+    const auto card = getSelectedStockPileCard();
+    if (not card)
+        return false;
+
+    const Cards cardsToAdd {card.value()};
+    auto& pile = *tableauPiles[destination];
+    if (not pile.canAddCards(cardsToAdd.begin(), cardsToAdd.end()))
+        return false;
+
+    saveTransactionSnapshotOnce(destination, pile);
+    pile.tryAddCards(cardsToAdd.begin(), cardsToAdd.end());
+    saveTransactionSnapshotOnce(GameState::stockPileIndex, *stockPile);
+    stockPile->tryPullOutCard();
+    return true;
+}
+
+bool Solitaire::tryMoveStockPileCardToFoundationPile(const PileId destination) {
+    throwExceptionOnInvalidFoundationPileId(destination);
+    auto cardToAdd = getSelectedStockPileCard();
+    auto& pile = *foundationPiles[destination];
+    if (not cardToAdd or not pile.canAddCard(cardToAdd.value()))
+        return false;
+
+    saveTransactionSnapshotOnce(GameState::firstFoundationPileIndex + destination, pile);
+    pile.tryAddCard(cardToAdd);
+    saveTransactionSnapshotOnce(GameState::stockPileIndex, *stockPile);
+    stockPile->tryPullOutCard();
+    ++foundationPilesCardsCount;
+    return true;
+}
+
+bool Solitaire::tryMoveFoundationPileCardToTableauPile(
+    const PileId source, const PileId destination)
+{
+    throwExceptionOnInvalidFoundationPileId(source);
+    throwExceptionOnInvalidTableauPileId(destination);
+    if (not foundationPiles[source]->canPullOutCard())
+        return false;
+
+    const Cards cardsToAdd {foundationPiles[source]->getCards().back()};
+    auto& pile = *tableauPiles[destination];
+    if (not pile.canAddCards(cardsToAdd.begin(), cardsToAdd.end()))
+        return false;
+
+    saveTransactionSnapshotOnce(destination, pile);
+    pile.tryAddCards(cardsToAdd.begin(), cardsToAdd.end());
+    saveTransactionSnapshotOnce(GameState::firstFoundationPileIndex + source,
+                                *foundationPiles[source]);
+    foundationPiles[source]->tryPullOutCard();
+    --foundationPilesCardsCount;
+    return true;
+}
+
+std::optional<Card> Solitaire::getSelectedStockPileCard() const {
+    const auto selectedCardIndex = stockPile->getSelectedCardIndex();
+    if (not selectedCardIndex)
+        return std::nullopt;
+    return stockPile->getCards()[selectedCardIndex.value()];
+}
+
+void Solitaire::saveTransactionSnapshotOnce(const unsigned pileIndex, Archiver& pile) {
+    const auto isPileSaved = std::find(transactionPilesIndexes.begin(),
+        transactionPilesIndexes.end(), pileIndex) != transactionPilesIndexes.end();
+
+    if (not isPileSaved) {
+        transactionPilesIndexes.push_back(pileIndex);
+        transactionSnapshots.push_back(pile.createSnapshot());
+    }
+}
+
+void Solitaire::commitTransaction() {
+    throwExceptionOnNoTransactionInProgress();
+    try {
+        saveTransactionHistory();
+    }
+    catch (...) {
+        endTransaction();
+        throw;
+    }
+    endTransaction();
+}
+
+void Solitaire::saveTransactionHistory() {
+    if (moveRecordsHistoryTracker) {
+        if (not transactionMoveRecords.empty())
+            moveRecordsHistoryTracker->save(transactionMoveRecords);
+    }
+    else if (not transactionSnapshots.empty())
+        historyTracker->save(std::make_unique<archivers::CompositeSnapshot>(
+            std::move(transactionSnapshots)));
+}
+
+void Solitaire::abortTransaction() {
+    throwExceptionOnNoTransactionInProgress();
+    try {
+        for (auto snapshot = transactionSnapshots.rbegin();
+             snapshot != transactionSnapshots.rend(); ++snapshot)
+            (*snapshot)->restore();
+    }
+    catch (...) {
+        countFoundationPilesCards();
+        endTransaction();
+        throw;
     }
+    countFoundationPilesCards();
+    endTransaction();
 }
 
-bool Solitaire::isGameInProgressAndHandIsEmpty() const {
-    return not isGameFinished() and cardsInHand.empty();
+void Solitaire::endTransaction() {
+    isTransactionInProgress = false;
+    transactionPilesIndexes.clear();
+    transactionSnapshots.clear();
+    transactionMoveRecords.clear();
+}
+
+bool Solitaire::isGameInProgressAndIdle() const {
+    return not isTransactionInProgress and not isGameFinished() and cardsInHand.empty();
 }
 
 void Solitaire::tryAddPulledOutCardToHand(
-    const std::optional<Card>& card, SnapshotPtr snapshot)
+    const std::optional<Card>& card, SnapshotPtr snapshot, const unsigned sourcePileIndex)
 {
     if (card) {
         moveCardsOperationSnapshotCreator->saveSourcePileSnapshot(std::move(snapshot));
+        handSourcePileIndex = sourcePileIndex;
         cardsInHand.push_back(card.value());
+        cardSetInHand.insert(card.value());
     }
 }
 
 bool Solitaire::isGameFinished() const {
-    return std::all_of(foundationPiles.begin(), foundationPiles.end(),
-        [](const auto& pile) {
-            return pile->getTopCardValue() == Value::King;
-        }
-    );
+    return foundationPilesCardsCount == std::tuple_size_v<Deck>;
+}
+
+std::uint64_t Solitaire::getPositionHash() const {
+    std::uint64_t hash = 0;
+    for (unsigned id = 0; id < tableauPilesCount; ++id)
+        hash ^= placeZobristHashOnPile(tableauPiles[id]->getPositionHash(), id);
+
+    for (unsigned id = 0; id < foundationPilesCount; ++id)
+        hash ^= placeZobristHashOnPile(foundationPiles[id]->getPositionHash(),
+                                       GameState::firstFoundationPileIndex + id);
+
+    return hash ^ placeZobristHashOnPile(stockPile->getPositionHash(),
+                                         GameState::stockPileIndex);
 }
 
 const FoundationPile& Solitaire::getFoundationPile(const PileId id) const {
@@ -233,6 +882,34 @@ const StockPile& Solitaire::getStockPile() const {
     return *stockPile;
 }
 
+void Solitaire::throwExceptionOnCardsInHand() const {
+    if (not cardsInHand.empty())
+        throw std::runtime_error {"Cannot export game state when cards are in hand"};
+}
+
+void Solitaire::throwExceptionIfTransactionCannotBegin() const {
+    if (isTransactionInProgress)
+        throw std::runtime_error {"Cannot begin transaction when other one is in progress"};
+    if (not cardsInHand.empty())
+        throw std::runtime_error {"Cannot begin transaction when cards are in hand"};
+}
+
+void Solitaire::throwExceptionOnTransactionInProgress(const std::string& operation) const {
+    if (isTransactionInProgress)
+        throw std::runtime_error {"Cannot " + operation + " when transaction is in progress"};
+}
+
+void Solitaire::throwExceptionOnNoTransactionInProgress() const {
+    if (not isTransactionInProgress)
+        throw std::runtime_error {"Cannot use transaction which is not in progress"};
+}
+
+void Solitaire::throwExceptionOnInvalidGameState(const GameState& gameState) const {
+    if (not areGameStatePilesSizesValid(gameState) or
+        not areGameStatePilesCardsValid(gameState))
+        throw std::runtime_error {"Cannot import invalid game state"};
+}
+
 void Solitaire::throwExceptionOnInvalidFoundationPileId(const PileId id) const {
     if (id.t >= foundationPilesCount)
         throw std::runtime_error {
@@ -251,4 +928,8 @@ const cards::Cards& Solitaire::getCardsInHand() const {
     return cardsInHand;
 }
 
+CardSet Solitaire::getCardSetInHand() const {
+    return cardSetInHand;
+}
+
 }
@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "archivers/CompositeSnapshot.h"
+
+namespace solitaire::archivers {
+
+CompositeSnapshot::CompositeSnapshot(Snapshots snapshots):
+    snapshots {std::move(snapshots)}
+{
+    if (std::any_of(this->snapshots.begin(), this->snapshots.end(),
+                    [](const auto& snapshot) { return not snapshot; }))
+        throw std::runtime_error {"Passed snapshot is nullptr."};
+}
+
+void CompositeSnapshot::restore() const {
+    for (auto snapshot = snapshots.rbegin(); snapshot != snapshots.rend(); ++snapshot)
+        (*snapshot)->restore();
+}
+
+bool CompositeSnapshot::isSnapshotOfSameObject(const interfaces::Snapshot&) const {
+    return false;
+}
+
+const void* CompositeSnapshot::getObjectKey() const {
+    return nullptr;
+}
+
+std::size_t CompositeSnapshot::getMemoryUsage() const {
+    auto memoryUsage = sizeof(*this) + snapshots.capacity() * sizeof(Snapshots::value_type);
+    for (const auto& snapshot: snapshots)
+        memoryUsage += snapshot->getMemoryUsage();
+    return memoryUsage;
+}
+
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <stdexcept>
 
 #include "archivers/HistoryTracker.h"
@@ -7,33 +8,104 @@ using namespace solitaire::archivers::interfaces;
 
 namespace solitaire::archivers {
 
-HistoryTracker::HistoryTracker(const unsigned historyMaxSize):
-    historyMaxSize {historyMaxSize} {
+HistoryTracker::HistoryTracker(const std::size_t memoryLimit):
+    memoryLimit {memoryLimit} {
 }
 
 void HistoryTracker::reset() {
-    history.clear();
+    for (auto& entry: entries)
+        entry = Entry {};
+
+    firstEntryIndex = 0;
+    entriesCount = 0;
+    olderEntriesMemoryUsage = 0;
 }
 
 void HistoryTracker::save(std::unique_ptr<Snapshot> snapshot) {
     if (not snapshot)
         throw std::runtime_error {"Passed snapshot is nullptr"};
 
-    if (history.size() >= historyMaxSize)
-        history.erase(history.begin());
-    history.emplace_back(std::move(snapshot));
+    if (entriesCount == entries.size())
+        makeRoomForEntry(snapshot->getMemoryUsage());
+
+    if (entriesCount > 0) {
+        auto& newestEntry = getEntry(entriesCount - 1);
+        newestEntry.memoryUsage = newestEntry.snapshot->getMemoryUsage();
+        olderEntriesMemoryUsage += newestEntry.memoryUsage;
+    }
+
+    getEntry(entriesCount).snapshot = std::move(snapshot);
+    ++entriesCount;
+
+    while (getMemoryUsage() > memoryLimit and entriesCount > 1)
+        removeOldestEntry();
+}
+
+void HistoryTracker::makeRoomForEntry(const std::size_t entryMemoryUsage) {
+    if (entries.empty() or canGrowCapacity(entryMemoryUsage))
+        growCapacity();
+    else
+        removeOldestEntry();
+}
+
+bool HistoryTracker::canGrowCapacity(const std::size_t entryMemoryUsage) const {
+    const auto addedMemoryUsage = entries.size() * sizeof(Entry);
+    return getMemoryUsage() + addedMemoryUsage + entryMemoryUsage <= memoryLimit;
+}
+
+void HistoryTracker::growCapacity() {
+    std::vector<Entry> grownEntries(std::max(initialCapacity, 2 * entries.size()));
+    for (std::size_t position = 0; position < entriesCount; ++position)
+        grownEntries[position] = std::move(getEntry(position));
+
+    entries = std::move(grownEntries);
+    firstEntryIndex = 0;
+}
+
+void HistoryTracker::removeOldestEntry() {
+    auto& oldestEntry = getEntry(0);
+    olderEntriesMemoryUsage -= oldestEntry.memoryUsage;
+    oldestEntry = Entry {};
+    firstEntryIndex = (firstEntryIndex + 1) % entries.size();
+    --entriesCount;
+}
+
+void HistoryTracker::removeNewestEntry() {
+    getEntry(entriesCount - 1) = Entry {};
+    --entriesCount;
+
+    if (entriesCount > 0) {
+        auto& newestEntry = getEntry(entriesCount - 1);
+        olderEntriesMemoryUsage -= newestEntry.memoryUsage;
+        newestEntry.memoryUsage = 0;
+    }
 }
 
 void HistoryTracker::undo() {
-    if (history.empty())
+    if (entriesCount == 0)
         throw std::runtime_error {"Cannot undo operation when history is empty."};
 
-    history.back()->restore();
-    history.pop_back();
+    getEntry(entriesCount - 1).snapshot->restore();
+    removeNewestEntry();
+}
+
+HistoryTracker::Entry& HistoryTracker::getEntry(const std::size_t position) {
+    return entries[(firstEntryIndex + position) % entries.size()];
+}
+
+const HistoryTracker::Entry& HistoryTracker::getEntry(const std::size_t position) const {
+    return entries[(firstEntryIndex + position) % entries.size()];
 }
 
 unsigned HistoryTracker::getHistorySize() const {
-    return history.size();
+    return entriesCount;
+}
+
+std::size_t HistoryTracker::getMemoryUsage() const {
+    auto memoryUsage = entries.size() * sizeof(Entry) + olderEntriesMemoryUsage;
+    if (entriesCount > 0)
+        memoryUsage += getEntry(entriesCount - 1).snapshot->getMemoryUsage();
+    return memoryUsage;
 }
 
 }
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "archivers/HistoryTree.h"
+#include "moves/MoveGenerator.h"
+#include "moves/ReversibleMoves.h"
+
+using namespace solitaire::moves;
+
+namespace solitaire::archivers {
+
+HistoryTree::HistoryTree(const GameState& initialGameState,
+                         const unsigned checkpointInterval):
+    checkpointInterval {checkpointInterval},
+    nodes(1),
+    checkpoints {initialGameState},
+    gameState {initialGameState}
+{
+    if (checkpointInterval == 0)
+        throw std::runtime_error {"Checkpoint interval should be greater than zero."};
+
+    nodes.front().checkpointIndex = 0;
+}
+
+HistoryTree::NodeId HistoryTree::addMove(const Move& move) {
+    throwExceptionOnIllegalMove(move);
+
+    const auto childNodeId = findChildNodeId(currentNodeId, move);
+    if (childNodeId) {
+        goToChildNode(childNodeId.value());
+        return currentNodeId;
+    }
+
+    const auto nodeId = addChildNode(currentNodeId, move);
+    goToChildNode(nodeId);
+    saveCheckpointIfNeeded(nodeId);
+    return nodeId;
+}
+
+std::optional<HistoryTree::NodeId>
+HistoryTree::findChildNodeId(const NodeId parentId, const Move& move) const {
+    for (auto nodeId = nodes[parentId].firstChildId; nodeId != noNodeId;
+         nodeId = nodes[nodeId].nextSiblingId)
+        if (nodes[nodeId].move == move)
+            return nodeId;
+
+    return std::nullopt;
+}
+
+HistoryTree::NodeId HistoryTree::addChildNode(const NodeId parentId, const Move& move) {
+    const NodeId nodeId = nodes.size();
+    Node node;
+    node.parentId = parentId;
+    node.nextSiblingId = nodes[parentId].firstChildId;
+    node.depth = nodes[parentId].depth + 1;
+    node.move = move;
+
+    nodes.push_back(node);
+    nodes[parentId].firstChildId = nodeId;
+    return nodeId;
+}
+
+void HistoryTree::saveCheckpointIfNeeded(const NodeId nodeId) {
+    if (nodes[nodeId].depth % checkpointInterval == 0) {
+        nodes[nodeId].checkpointIndex = checkpoints.size();
+        checkpoints.push_back(gameState);
+    }
+}
+
+void HistoryTree::goToChildNode(const NodeId nodeId) {
+    applyMove(gameState, nodes[nodeId].move);
+    nodes[currentNodeId].lastVisitedChildId = nodeId;
+    currentNodeId = nodeId;
+}
+
+bool HistoryTree::tryUndo() {
+    if (currentNodeId == rootNodeId)
+        return false;
+
+    undoMove(gameState, nodes[currentNodeId].move);
+    currentNodeId = nodes[currentNodeId].parentId;
+    return true;
+}
+
+bool HistoryTree::tryRedo() {
+    const auto nodeId = nodes[currentNodeId].lastVisitedChildId;
+    if (nodeId == noNodeId)
+        return false;
+
+    goToChildNode(nodeId);
+    return true;
+}
+
+void HistoryTree::seek(const NodeId targetNodeId) {
+    throwExceptionOnInvalidNodeId(targetNodeId);
+
+    std::vector<NodeId> nodesToReplay;
+    auto nodeId = targetNodeId;
+    while (nodes[nodeId].checkpointIndex == noCheckpointIndex) {
+        nodesToReplay.push_back(nodeId);
+        nodeId = nodes[nodeId].parentId;
+    }
+
+    gameState = checkpoints[nodes[nodeId].checkpointIndex];
+    currentNodeId = nodeId;
+    std::for_each(nodesToReplay.rbegin(), nodesToReplay.rend(),
+                  [this](const NodeId nodeId) { goToChildNode(nodeId); });
+}
+
+const GameState& HistoryTree::getGameState() const {
+    return gameState;
+}
+
+HistoryTree::NodeId HistoryTree::getCurrentNodeId() const {
+    return currentNodeId;
+}
+
+std::optional<HistoryTree::NodeId> HistoryTree::getParentNodeId(const NodeId nodeId) const {
+    throwExceptionOnInvalidNodeId(nodeId);
+    if (nodeId == rootNodeId)
+        return std::nullopt;
+    return nodes[nodeId].parentId;
+}
+
+std::vector<HistoryTree::NodeId> HistoryTree::getChildrenNodesIds(const NodeId nodeId) const {
+    throwExceptionOnInvalidNodeId(nodeId);
+
+    std::vector<NodeId> childrenNodesIds;
+    for (auto childNodeId = nodes[nodeId].firstChildId; childNodeId != noNodeId;
+         childNodeId = nodes[childNodeId].nextSiblingId)
+        childrenNodesIds.push_back(childNodeId);
+
+    std::reverse(childrenNodesIds.begin(), childrenNodesIds.end());
+    return childrenNodesIds;
+}
+
+Move HistoryTree::getMove(const NodeId nodeId) const {
+    throwExceptionOnInvalidNodeId(nodeId);
+    if (nodeId == rootNodeId)
+        throw std::runtime_error {"Root node of history tree has no move."};
+    return nodes[nodeId].move;
+}
+
+unsigned HistoryTree::getDepth(const NodeId nodeId) const {
+    throwExceptionOnInvalidNodeId(nodeId);
+    return nodes[nodeId].depth;
+}
+
+std::size_t HistoryTree::getNodesCount() const {
+    return nodes.size();
+}
+
+std::size_t HistoryTree::getCheckpointsCount() const {
+    return checkpoints.size();
+}
+
+std::size_t HistoryTree::getMemoryUsage() const {
+    return nodes.capacity() * sizeof(Node) + checkpoints.capacity() * sizeof(GameState);
+}
+
+void HistoryTree::throwExceptionOnIllegalMove(const Move& move) const {
+    MoveGenerator::Moves legalMoves;
+    const auto legalMovesEnd =
+        std::next(legalMoves.begin(), MoveGenerator {gameState}.generate(legalMoves));
+
+    if (std::find(legalMoves.begin(), legalMovesEnd, move) == legalMovesEnd)
+        throw std::runtime_error {"Cannot add illegal move to history tree."};
+}
+
+void HistoryTree::throwExceptionOnInvalidNodeId(const NodeId nodeId) const {
+    if (nodeId >= nodes.size())
+        throw std::runtime_error {
+            "Cannot access history tree node with id: " + std::to_string(nodeId)
+        };
+}
+
+}
@@ -3,6 +3,15 @@
 
 namespace solitaire::archivers {
 
+MoveCardsOperationSnapshotCreator::MoveCardsOperationSnapshotCreator():
+    MoveCardsOperationSnapshotCreator {std::make_shared<SnapshotsPool>()} {
+}
+
+MoveCardsOperationSnapshotCreator::MoveCardsOperationSnapshotCreator(
+    std::shared_ptr<SnapshotsPool> snapshotsPool):
+    snapshotsPool {std::move(snapshotsPool)} {
+}
+
 std::unique_ptr<interfaces::Snapshot>
 MoveCardsOperationSnapshotCreator::createSnapshotIfCardsMovedToOtherPile(
     std::unique_ptr<interfaces::Snapshot> destinationPileSnapshot)
@@ -16,9 +25,11 @@ MoveCardsOperationSnapshotCreator::createSnapshotIfCardsMovedToOtherPile(
         return nullptr;
     }
 
-    return std::make_unique<Snapshot>(
-        std::move(sourcePileSnapshot), std::move(destinationPileSnapshot)
-    );
+    static_assert(sizeof(Snapshot) <= SnapshotsPool::maxSnapshotSize);
+    return std::unique_ptr<interfaces::Snapshot> {
+        new (*snapshotsPool) Snapshot(
+            std::move(sourcePileSnapshot), std::move(destinationPileSnapshot))
+    };
 }
 
 void MoveCardsOperationSnapshotCreator::saveSourcePileSnapshot(
@@ -70,4 +81,13 @@ bool MoveCardsOperationSnapshotCreator::Snapshot::isSnapshotOfSameObject(
     return false;
 }
 
+const void* MoveCardsOperationSnapshotCreator::Snapshot::getObjectKey() const {
+    return nullptr;
+}
+
+std::size_t MoveCardsOperationSnapshotCreator::Snapshot::getMemoryUsage() const {
+    return SnapshotsPool::getBlockSize() + sourcePileSnapshot->getMemoryUsage() +
+        destinationPileSnapshot->getMemoryUsage();
+}
+
 }
@@ -0,0 +1,15 @@
+#include "archivers/MoveRecord.h"
+
+namespace solitaire::archivers {
+
+static_assert(sizeof(MoveRecord) == 4, "MoveRecord should be packed into four bytes");
+
+std::ostream& operator<<(std::ostream& os, const MoveRecord& record)
+{
+    return os << "MoveRecord {type: " << static_cast<unsigned>(record.type)
+              << ", source: " << static_cast<unsigned>(record.sourcePileIndex)
+              << ", destination: " << static_cast<unsigned>(record.destinationPileIndex)
+              << ", cards count: " << static_cast<unsigned>(record.cardsCount) << '}';
+}
+
+}
@@ -0,0 +1,96 @@
+#include <iterator>
+#include <stdexcept>
+
+#include "archivers/MoveRecordsHistoryTracker.h"
+
+namespace solitaire::archivers {
+
+MoveRecordsHistoryTracker::MoveRecordsHistoryTracker(const std::size_t memoryLimit):
+    memoryLimit {memoryLimit} {
+}
+
+void MoveRecordsHistoryTracker::reset() {
+    records.clear();
+    entriesSizes.clear();
+    historySize = 0;
+    historyRecordsCount = 0;
+}
+
+void MoveRecordsHistoryTracker::save(const MoveRecord& record) {
+    saveEntry(&record, std::next(&record));
+}
+
+void MoveRecordsHistoryTracker::save(const MoveRecords& entryRecords) {
+    if (entryRecords.empty())
+        throw std::runtime_error {"Passed move records are empty."};
+
+    saveEntry(entryRecords.begin(), entryRecords.end());
+}
+
+template <class Iterator>
+void MoveRecordsHistoryTracker::saveEntry(const Iterator firstRecord,
+                                          const Iterator lastRecord)
+{
+    discardRedoEntries();
+
+    records.insert(records.end(), firstRecord, lastRecord);
+    entriesSizes.push_back(std::distance(firstRecord, lastRecord));
+    historyRecordsCount = records.size();
+    ++historySize;
+
+    while (getMemoryUsage() > memoryLimit and historySize > 1)
+        removeOldestEntry();
+}
+
+void MoveRecordsHistoryTracker::discardRedoEntries() {
+    records.erase(std::next(records.begin(), historyRecordsCount), records.end());
+    entriesSizes.resize(historySize);
+}
+
+void MoveRecordsHistoryTracker::removeOldestEntry() {
+    const auto entrySize = entriesSizes.front();
+    records.erase(records.begin(), std::next(records.begin(), entrySize));
+    entriesSizes.pop_front();
+    historyRecordsCount -= entrySize;
+    --historySize;
+}
+
+MoveRecords MoveRecordsHistoryTracker::undo() {
+    if (historySize == 0)
+        throw std::runtime_error {"Cannot undo operation when history is empty."};
+
+    const auto entrySize = entriesSizes[--historySize];
+    historyRecordsCount -= entrySize;
+    return getEntryRecords(historyRecordsCount, entrySize);
+}
+
+MoveRecords MoveRecordsHistoryTracker::redo() {
+    if (getRedoSize() == 0)
+        throw std::runtime_error {"Cannot redo operation when no operation was undone."};
+
+    const auto entrySize = entriesSizes[historySize++];
+    const auto firstRecordPosition = historyRecordsCount;
+    historyRecordsCount += entrySize;
+    return getEntryRecords(firstRecordPosition, entrySize);
+}
+
+MoveRecords MoveRecordsHistoryTracker::getEntryRecords(
+    const std::size_t firstRecordPosition, const unsigned entrySize) const
+{
+    const auto firstRecord = std::next(records.begin(), firstRecordPosition);
+    return MoveRecords {firstRecord, std::next(firstRecord, entrySize)};
+}
+
+unsigned MoveRecordsHistoryTracker::getHistorySize() const {
+    return historySize;
+}
+
+unsigned MoveRecordsHistoryTracker::getRedoSize() const {
+    return entriesSizes.size() - historySize;
+}
+
+std::size_t MoveRecordsHistoryTracker::getMemoryUsage() const {
+    return records.size() * sizeof(MoveRecord) + entriesSizes.size() * sizeof(unsigned);
+}
+
+}
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "archivers/SnapshotsPool.h"
+
+namespace solitaire::archivers {
+
+SnapshotsPool::SnapshotsPool(const std::size_t blocksCount,
+                             const std::size_t maxBlocksCount):
+    maxBlocksCount {maxBlocksCount} {
+    if (blocksCount > 0)
+        addChunk(std::min(blocksCount, maxBlocksCount));
+}
+
+std::size_t SnapshotsPool::getBlocksCountForMemoryLimit(const std::size_t memoryLimit) {
+    return memoryLimit / getBlockSize();
+}
+
+void* SnapshotsPool::allocate(const std::size_t snapshotSize) {
+    static_assert(std::is_standard_layout_v<Block>,
+                  "Snapshot storage should be placed at the beginning of block");
+
+    if (snapshotSize > maxSnapshotSize)
+        throw std::runtime_error {"Snapshot is too big to be allocated from pool."};
+
+    if (not firstFreeBlock) {
+        throwExceptionOnMaxBlocksCountReached();
+        addChunk(std::min(std::max(minBlocksPerChunk, blocksCount),
+                          maxBlocksCount - blocksCount));
+    }
+
+    auto& block = *firstFreeBlock;
+    firstFreeBlock = block.nextFreeBlock;
+    block.nextFreeBlock = nullptr;
+    block.pool = shared_from_this();
+    --freeBlocksCount;
+    return block.snapshot;
+}
+
+void SnapshotsPool::deallocate(void* const snapshot) {
+    auto& block = *reinterpret_cast<Block*>(snapshot);
+    const auto pool = std::move(block.pool);
+    pool->releaseBlock(block);
+}
+
+void SnapshotsPool::addChunk(const std::size_t chunkBlocksCount) {
+    chunks.push_back(std::make_unique<Block[]>(chunkBlocksCount));
+    for (std::size_t index = 0; index < chunkBlocksCount; ++index)
+        releaseBlock(chunks.back()[index]);
+
+    blocksCount += chunkBlocksCount;
+}
+
+void SnapshotsPool::throwExceptionOnMaxBlocksCountReached() const {
+    if (blocksCount >= maxBlocksCount)
+        throw std::runtime_error {"Snapshots pool reached its max blocks count."};
+}
+
+void SnapshotsPool::releaseBlock(Block& block) {
+    block.nextFreeBlock = firstFreeBlock;
+    firstFreeBlock = &block;
+    ++freeBlocksCount;
+}
+
+std::size_t SnapshotsPool::getBlocksCount() const {
+    return blocksCount;
+}
+
+std::size_t SnapshotsPool::getMaxBlocksCount() const {
+    return maxBlocksCount;
+}
+
+std::size_t SnapshotsPool::getFreeBlocksCount() const {
+    return freeBlocksCount;
+}
+
+std::size_t SnapshotsPool::getMemoryUsage() const {
+    return blocksCount * getBlockSize() +
+           chunks.capacity() * sizeof(decltype(chunks)::value_type);
+}
+
+void* PooledSnapshot::operator new(const std::size_t size, SnapshotsPool& pool) {
+    return pool.allocate(size);
+}
+
+void PooledSnapshot::operator delete(void* const snapshot, SnapshotsPool&) {
+    SnapshotsPool::deallocate(snapshot);
+}
+
+void PooledSnapshot::operator delete(void* const snapshot) {
+    SnapshotsPool::deallocate(snapshot);
+}
+
+}
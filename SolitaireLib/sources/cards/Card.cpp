@@ -4,40 +4,7 @@
 
 namespace solitaire::cards {
 
-Card::Card(): Card(Value::Ace, Suit::Heart) {
-}
-
-Card::Card(const Value value, const Suit suit):
-    value(value), suit(suit) {
-}
-
-Value Card::getValue() const {
-    return value;
-}
-
-Suit Card::getSuit() const {
-    return suit;
-}
-
-bool Card::hasValueOneGreaterThan(const Card& card) const {
-    return to_int(value) - 1 == to_int(card.value);
-}
-
-bool Card::hasSameSuitAs(const Card& card) const {
-    return suit == card.getSuit();
-}
-
-bool Card::hasDifferentColorThan(const Card& card) const {
-    return hasRedColor() != card.hasRedColor();
-}
-
-bool Card::hasRedColor() const {
-    return suit == Suit::Heart or suit == Suit::Diamond;
-}
-
-bool operator==(const Card& lhs, const Card& rhs) {
-    return lhs.getValue() == rhs.getValue() and lhs.getSuit() == rhs.getSuit();
-}
+static_assert(sizeof(Card) == 1, "Card should be packed into one byte");
 
 std::ostream& operator<<(std::ostream& os, const Card& card)
 {
@@ -0,0 +1,16 @@
+#include <iomanip>
+
+#include "cards/CardSet.h"
+
+namespace solitaire::cards {
+
+std::ostream& operator<<(std::ostream& os, const CardSet& cardSet)
+{
+    const auto flags = os.flags();
+    os << "CardSet {0x" << std::hex << std::setw(16) << std::setfill('0')
+       << cardSet.getBits() << '}';
+    os.flags(flags);
+    return os;
+}
+
+}
@@ -0,0 +1,254 @@
+#include <limits>
+#include <utility>
+#include <stdexcept>
+
+#include "cards/Card.h"
+#include "cards/DealNumber.h"
+
+namespace solitaire::cards {
+
+namespace {
+constexpr unsigned cardsCount {std::tuple_size<Deck>::value};
+constexpr std::uint64_t maxChunkRadix {std::numeric_limits<std::uint32_t>::max()};
+constexpr std::uint64_t allCardsMask {0x1FFF1FFF1FFF1FFF};
+constexpr std::uint64_t bytesOnes {0x0101010101010101};
+constexpr std::uint64_t bytesHighBits {0x8080808080808080};
+
+using LehmerCode = std::array<std::uint8_t, cardsCount>;
+
+constexpr Card getCardFromBitIndex(const unsigned index) {
+    return Card {Value (index & Card::valueMask), Suit (index >> Card::suitShift)};
+}
+
+constexpr auto createSetBitIndicesInByte() {
+    std::array<std::array<std::uint8_t, 8>, 256> setBitIndices {};
+    for (unsigned byte = 0; byte < setBitIndices.size(); ++byte) {
+        unsigned rank = 0;
+        for (unsigned index = 0; index < 8; ++index)
+            if ((byte >> index & 1) != 0)
+                setBitIndices[byte][rank++] = index;
+    }
+    return setBitIndices;
+}
+
+constexpr auto setBitIndicesInByte {createSetBitIndicesInByte()};
+
+constexpr unsigned getRadix(const unsigned position) {
+    return cardsCount - position;
+}
+
+struct RadixChunk {
+    unsigned firstPosition;
+    unsigned lastPosition;
+    std::uint32_t radix;
+};
+
+template <class Callback>
+constexpr void forEachRadixChunk(Callback callback) {
+    int lastPosition = cardsCount - 1;
+    while (lastPosition >= 0) {
+        std::uint64_t radix = 1;
+        int firstPosition = lastPosition;
+        while (firstPosition >= 0 and radix * getRadix(firstPosition) <= maxChunkRadix)
+            radix *= getRadix(firstPosition--);
+
+        callback(RadixChunk {static_cast<unsigned>(firstPosition + 1),
+                             static_cast<unsigned>(lastPosition),
+                             static_cast<std::uint32_t>(radix)});
+        lastPosition = firstPosition;
+    }
+}
+
+constexpr unsigned countRadixChunks() {
+    unsigned count = 0;
+    forEachRadixChunk([&count](const RadixChunk&) { ++count; });
+    return count;
+}
+
+constexpr auto createRadixChunks() {
+    std::array<RadixChunk, countRadixChunks()> chunks {};
+    unsigned index = 0;
+    forEachRadixChunk([&](const RadixChunk& chunk) { chunks[index++] = chunk; });
+    return chunks;
+}
+
+constexpr auto radixChunks {createRadixChunks()};
+
+std::uint64_t countBitsInEachByte(std::uint64_t bits) {
+    bits = bits - ((bits >> 1) & 0x5555555555555555);
+    bits = (bits & 0x3333333333333333) + ((bits >> 2) & 0x3333333333333333);
+    return (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0F;
+}
+
+unsigned countBits(const std::uint64_t bits) {
+    return (countBitsInEachByte(bits) * bytesOnes) >> 56;
+}
+
+unsigned getSetBitIndex(const std::uint64_t bits, const unsigned rank) {
+    const auto setBitsCountsUpToByte = countBitsInEachByte(bits) * bytesOnes;
+    const auto byteIndex = countBits(
+        ((rank * bytesOnes | bytesHighBits) - setBitsCountsUpToByte) & bytesHighBits);
+    const auto byteShift = byteIndex * 8;
+    const auto rankInByte = rank - ((setBitsCountsUpToByte << 8) >> byteShift & 0xFF);
+    return byteShift + setBitIndicesInByte[bits >> byteShift & 0xFF][rankInByte];
+}
+
+std::uint64_t getCardBit(const Card& card) {
+    return std::uint64_t {1} << card.getCode();
+}
+
+LehmerCode createLehmerCode(const Deck& deck) {
+    LehmerCode lehmerCode;
+    std::uint64_t remainingCards = allCardsMask;
+
+    for (unsigned position = 0; position < cardsCount; ++position) {
+        const auto cardBit = getCardBit(deck[position]);
+        if ((remainingCards & cardBit) == 0)
+            throw std::runtime_error {"Deck does not contain every card exactly once"};
+
+        lehmerCode[position] = countBits(remainingCards & (cardBit - 1));
+        remainingCards ^= cardBit;
+    }
+
+    return lehmerCode;
+}
+
+template <std::uint32_t Divisor>
+std::uint32_t divideAndGetRemainder(DealNumber::Words& words) {
+    auto significantWordsCount = DealNumber::wordsCount;
+    while (significantWordsCount > 0 and words[significantWordsCount - 1] == 0)
+        --significantWordsCount;
+
+    std::uint64_t remainder = 0;
+    for (auto i = significantWordsCount; i > 0; --i) {
+        const auto dividend = remainder << 32 | words[i - 1];
+        words[i - 1] = static_cast<std::uint32_t>(dividend / Divisor);
+        remainder = dividend % Divisor;
+    }
+    return static_cast<std::uint32_t>(remainder);
+}
+
+template <std::size_t ChunkIndex>
+void extractLehmerCodeChunk(DealNumber::Words& quotient, LehmerCode& lehmerCode) {
+    constexpr auto chunk = radixChunks[ChunkIndex];
+    auto chunkValue = divideAndGetRemainder<chunk.radix>(quotient);
+
+    for (auto position = chunk.lastPosition + 1; position > chunk.firstPosition; --position) {
+        lehmerCode[position - 1] = chunkValue % getRadix(position - 1);
+        chunkValue /= getRadix(position - 1);
+    }
+}
+
+template <std::size_t... ChunkIndices>
+void extractLehmerCode(DealNumber::Words& quotient, LehmerCode& lehmerCode,
+                       std::index_sequence<ChunkIndices...>)
+{
+    (extractLehmerCodeChunk<ChunkIndices>(quotient, lehmerCode), ...);
+}
+
+Deck createDeck(const LehmerCode& lehmerCode) {
+    Deck deck;
+    std::uint64_t remainingCards = allCardsMask;
+
+    for (unsigned position = 0; position < cardsCount; ++position) {
+        const auto cardBitIndex = getSetBitIndex(remainingCards, lehmerCode[position]);
+        remainingCards ^= std::uint64_t {1} << cardBitIndex;
+        deck[position] = getCardFromBitIndex(cardBitIndex);
+    }
+
+    return deck;
+}
+
+}
+
+DealNumber::DealNumber(const std::uint64_t number):
+    words {static_cast<std::uint32_t>(number),
+           static_cast<std::uint32_t>(number >> 32)} {
+}
+
+DealNumber::DealNumber(const Words& words): words {words} {
+}
+
+DealNumber DealNumber::fromDeck(const Deck& deck) {
+    const auto lehmerCode = createLehmerCode(deck);
+    DealNumber dealNumber;
+
+    for (auto chunk = radixChunks.rbegin(); chunk != radixChunks.rend(); ++chunk) {
+        std::uint32_t chunkValue = 0;
+        for (auto position = chunk->firstPosition; position <= chunk->lastPosition; ++position)
+            chunkValue = chunkValue * getRadix(position) + lehmerCode[position];
+        dealNumber.multiplyAndAdd(chunk->radix, chunkValue);
+    }
+
+    return dealNumber;
+}
+
+Deck DealNumber::toDeck() const {
+    LehmerCode lehmerCode;
+    auto quotient = words;
+    extractLehmerCode(quotient, lehmerCode, std::make_index_sequence<radixChunks.size()> {});
+
+    if (quotient != Words {})
+        throw std::runtime_error {"Deal number is out of range: " + to_string(*this)};
+
+    return createDeck(lehmerCode);
+}
+
+const DealNumber& DealNumber::getDealsCount() {
+    static const DealNumber dealsCount {[] {
+        DealNumber factorial {1};
+        for (unsigned position = 0; position < cardsCount; ++position)
+            factorial.multiplyAndAdd(getRadix(position), 0);
+        return factorial;
+    }()};
+    return dealsCount;
+}
+
+DealNumber& DealNumber::operator++() {
+    multiplyAndAdd(1, 1);
+    if (*this == getDealsCount())
+        words.fill(0);
+    return *this;
+}
+
+const DealNumber::Words& DealNumber::getWords() const {
+    return words;
+}
+
+void DealNumber::multiplyAndAdd(const std::uint32_t multiplier,
+                                const std::uint32_t addend)
+{
+    std::uint64_t carry = addend;
+    for (auto& word: words) {
+        carry += static_cast<std::uint64_t>(word) * multiplier;
+        word = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+}
+
+bool operator==(const DealNumber& lhs, const DealNumber& rhs) {
+    return lhs.getWords() == rhs.getWords();
+}
+
+bool operator!=(const DealNumber& lhs, const DealNumber& rhs) {
+    return not (lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const DealNumber& dealNumber) {
+    return os << "DealNumber {" << to_string(dealNumber) << '}';
+}
+
+std::string to_string(const DealNumber& dealNumber) {
+    static constexpr char hexDigits[] {"0123456789abcdef"};
+    std::string result;
+
+    const auto& words = dealNumber.getWords();
+    for (auto word = words.rbegin(); word != words.rend(); ++word)
+        for (int shift = 28; shift >= 0; shift -= 4)
+            if (const auto digit = (*word >> shift) & 0xF; digit != 0 or not result.empty())
+                result += hexDigits[digit];
+
+    return result.empty() ? "0" : result;
+}
+
+}
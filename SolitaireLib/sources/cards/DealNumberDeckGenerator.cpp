@@ -0,0 +1,16 @@
+#include "cards/Card.h"
+#include "cards/DealNumberDeckGenerator.h"
+
+namespace solitaire::cards {
+
+DealNumberDeckGenerator::DealNumberDeckGenerator(const DealNumber& firstDealNumber):
+    nextDealNumber {firstDealNumber} {
+}
+
+Deck DealNumberDeckGenerator::generate() const {
+    const auto deck = nextDealNumber.toDeck();
+    ++nextDealNumber;
+    return deck;
+}
+
+}
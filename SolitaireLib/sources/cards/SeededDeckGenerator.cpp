@@ -0,0 +1,107 @@
+#include <utility>
+
+#include "cards/Card.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+
+namespace solitaire::cards {
+
+namespace {
+constexpr unsigned valuesCount {13};
+constexpr unsigned suitsCount {4};
+
+constexpr Deck createSortedDeck() {
+    Deck sortedDeck {};
+    unsigned index = 0;
+    for (unsigned suit = 0; suit < suitsCount; ++suit)
+        for (unsigned value = 0; value < valuesCount; ++value)
+            sortedDeck[index++] = Card {Value (value), Suit (suit)};
+    return sortedDeck;
+}
+
+constexpr Deck sortedDeck {createSortedDeck()};
+
+constexpr std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t result = (state += 0x9E3779B97F4A7C15);
+    result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9;
+    result = (result ^ (result >> 27)) * 0x94D049BB133111EB;
+    return result ^ (result >> 31);
+}
+
+class Xoshiro256StarStar {
+public:
+    Xoshiro256StarStar(const std::uint64_t seed, const std::uint64_t streamNumber) {
+        std::uint64_t seedState = seed;
+        std::uint64_t splitMixState = splitMix64(seedState) ^ streamNumber;
+        for (auto& word: state)
+            word = splitMix64(splitMixState);
+    }
+
+    std::uint64_t next() {
+        const std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotateLeft(state[3], 45);
+
+        return result;
+    }
+
+private:
+    static std::uint64_t rotateLeft(const std::uint64_t x, const int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::uint64_t state[4];
+};
+
+std::uint32_t getBoundedRandomNumber(const std::uint32_t random, const std::uint32_t bound) {
+    return static_cast<std::uint32_t>(
+        (static_cast<std::uint64_t>(random) * bound) >> 32);
+}
+}
+
+SeededDeckGenerator::SeededDeckGenerator(const std::uint64_t seed,
+                                         const std::uint64_t firstDealNumber,
+                                         const std::uint64_t dealNumberStride):
+    seed {seed},
+    dealNumberStride {dealNumberStride},
+    nextDealNumber {firstDealNumber} {
+}
+
+Deck SeededDeckGenerator::generate() const {
+    const auto dealNumber = nextDealNumber;
+    nextDealNumber += dealNumberStride;
+    return generateDeal(seed, dealNumber);
+}
+
+Deck SeededDeckGenerator::generateDeal(const std::uint64_t seed,
+                                       const std::uint64_t dealNumber)
+{
+    Deck deck {sortedDeck};
+    Xoshiro256StarStar generator {seed, dealNumber};
+
+    for (std::uint32_t bound = deck.size(); bound > 1; bound -= 2) {
+        const auto random = generator.next();
+        std::swap(deck[bound - 1], deck[getBoundedRandomNumber(
+            static_cast<std::uint32_t>(random), bound)]);
+        std::swap(deck[bound - 2], deck[getBoundedRandomNumber(
+            static_cast<std::uint32_t>(random >> 32), bound - 1)]);
+    }
+
+    return deck;
+}
+
+void SeededDeckGenerator::generateBatch(const std::uint64_t seed,
+                                        const std::size_t count, Deck* decks)
+{
+    for (std::size_t dealNumber = 0; dealNumber < count; ++dealNumber)
+        decks[dealNumber] = generateDeal(seed, dealNumber);
+}
+
+}
@@ -44,6 +44,9 @@ void EventsProcessor::processEvent(const Event& event) {
         receivedQuitEvent = true;
     else if (std::holds_alternative<MouseLeftButtonDown>(event))
         processMouseLeftButtonDownEvent(std::get<MouseLeftButtonDown>(event));
+    else if (std::holds_alternative<MouseLeftButtonDoubleClick>(event))
+        processMouseLeftButtonDoubleClickEvent(
+            std::get<MouseLeftButtonDoubleClick>(event));
     else if (std::holds_alternative<MouseLeftButtonUp>(event))
         processMouseLeftButtonUpEvent();
     else if (std::holds_alternative<MouseMove>(event))
@@ -59,6 +62,16 @@ void EventsProcessor::processMouseLeftButtonDownEvent(
     tryInteractWithStockPile(event);
 }
 
+void EventsProcessor::processMouseLeftButtonDoubleClickEvent(
+    const MouseLeftButtonDoubleClick& event) const
+{
+    auto& solitaire = context.getSolitaire();
+    if (solitaire.canAutoComplete())
+        solitaire.tryAutoComplete();
+    else
+        processMouseLeftButtonDownEvent(MouseLeftButtonDown {event.position});
+}
+
 bool EventsProcessor::checkIfCollidesAndTryClickButtons(
     const MouseLeftButtonDown& event) const
 {
@@ -18,6 +18,9 @@ Event SDLEventsSource::getEvent() const {
     while (sdl->pollEvent(event)) {
         switch (event.type) {
         case SDL_MOUSEBUTTONDOWN:
+            if (event.button.button == SDL_BUTTON_LEFT and event.button.clicks == 2)
+                return MouseLeftButtonDoubleClick {
+                    Position {event.button.x, event.button.y}};
             if (event.button.button == SDL_BUTTON_LEFT)
                 return MouseLeftButtonDown {Position {event.button.x, event.button.y}};
             break;
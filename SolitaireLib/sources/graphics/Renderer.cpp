@@ -16,6 +16,8 @@
 #include "interfaces/piles/FoundationPile.h"
 #include "interfaces/piles/StockPile.h"
 #include "interfaces/piles/TableauPile.h"
+#include "interfaces/solvers/HintEngine.h"
+#include "moves/Move.h"
 #include "piles/PileId.h"
 
 using namespace solitaire::cards;
@@ -23,6 +25,7 @@ using namespace solitaire::colliders::interfaces;
 using namespace solitaire::geometry;
 using namespace solitaire::graphics::interfaces;
 using namespace solitaire::interfaces;
+using namespace solitaire::moves;
 using namespace solitaire::piles;
 
 namespace solitaire::graphics {
@@ -107,6 +110,7 @@ void Renderer::renderPiles() const {
         renderTableauPile(id);
 
     renderStockPile();
+    renderHint();
     renderCardsInHand();
 }
 
@@ -218,6 +222,54 @@ void Renderer::renderStockPileUncoveredCards(
     }
 }
 
+void Renderer::renderHint() const {
+    const auto hint = context.getHintEngine().getHint();
+    if (not hint) return;
+
+    const auto source = PileId {hint->getSource()};
+    const auto destination = PileId {hint->getDestination()};
+
+    switch (hint->getType()) {
+        case MoveType::SelectNextStockPileCard:
+            renderCardPlaceholder(Layout::stockPilePosition);
+            break;
+        case MoveType::UncoverTableauPileTopCard:
+            renderTableauPileHint(source, 1);
+            break;
+        case MoveType::MoveStockPileCardToTableauPile:
+            renderCardPlaceholder(context.getStockPileCollider().getUncoveredCardsPosition());
+            renderTableauPileHint(destination, 1);
+            break;
+        case MoveType::MoveStockPileCardToFoundationPile:
+            renderCardPlaceholder(context.getStockPileCollider().getUncoveredCardsPosition());
+            renderCardPlaceholder(getFoundationPilePosition(destination));
+            break;
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            renderTableauPileHint(source, hint->getQuantity());
+            renderTableauPileHint(destination, 1);
+            break;
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            renderTableauPileHint(source, 1);
+            renderCardPlaceholder(getFoundationPilePosition(destination));
+            break;
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            renderCardPlaceholder(getFoundationPilePosition(source));
+            renderTableauPileHint(destination, 1);
+            break;
+    }
+}
+
+void Renderer::renderTableauPileHint(const PileId id, const unsigned quantity) const {
+    const auto pileSize = context.getSolitaire().getTableauPile(id).getCards().size();
+    if (pileSize == 0) {
+        renderCardPlaceholder(Layout::getTableauPilePosition(id));
+        return;
+    }
+
+    renderCardPlaceholder(
+        context.getTableauPileCollider(id).getCardPosition(pileSize - quantity));
+}
+
 void Renderer::renderCardsInHand() const {
     const auto& cards = context.getSolitaire().getCardsInHand();
     if (not cards.empty()) {
@@ -0,0 +1,15 @@
+#include "moves/Move.h"
+
+namespace solitaire::moves {
+
+static_assert(sizeof(Move) == 2, "Move should be packed into two bytes");
+
+std::ostream& operator<<(std::ostream& os, const Move& move)
+{
+    return os << "Move {type: " << to_string(move.getType())
+              << ", source: " << move.getSource()
+              << ", destination: " << move.getDestination()
+              << ", quantity: " << move.getQuantity() << '}';
+}
+
+}
@@ -0,0 +1,174 @@
+#include <numeric>
+
+#include "cards/CardPlacementRules.h"
+#include "moves/MoveGenerator.h"
+
+using namespace solitaire::cards;
+
+namespace solitaire::moves {
+
+namespace {
+constexpr unsigned tableauPilesCount {interfaces::Solitaire::tableauPilesCount};
+constexpr unsigned foundationPilesCount {interfaces::Solitaire::foundationPilesCount};
+}
+
+MoveGenerator::MoveGenerator(const GameState& gameState):
+    gameState {gameState},
+    pilesOffsets {gameState.getPilesOffsets()} {
+}
+
+unsigned MoveGenerator::generate(Moves& moves) const {
+    unsigned movesCount = 0;
+    if (isGameFinished())
+        return movesCount;
+
+    generateTableauPilesUncovering(moves, movesCount);
+    generateTableauPilesToFoundationPilesMoves(moves, movesCount);
+    generateStockPileToFoundationPilesMoves(moves, movesCount);
+    generateTableauPilesToTableauPilesMoves(moves, movesCount);
+    generateStockPileToTableauPilesMoves(moves, movesCount);
+    generateFoundationPilesToTableauPilesMoves(moves, movesCount);
+    generateStockPileCardSelection(moves, movesCount);
+    return movesCount;
+}
+
+void MoveGenerator::generateTableauPilesUncovering(
+    Moves& moves, unsigned& movesCount) const
+{
+    for (unsigned id = 0; id < tableauPilesCount; ++id)
+        if (isTableauPileTopCardCovered(id))
+            moves[movesCount++] = Move {MoveType::UncoverTableauPileTopCard, id};
+}
+
+void MoveGenerator::generateTableauPilesToFoundationPilesMoves(
+    Moves& moves, unsigned& movesCount) const
+{
+    for (unsigned source = 0; source < tableauPilesCount; ++source) {
+        if (getTableauPileUncoveredCardsCount(source) == 0)
+            continue;
+
+        const auto& card = getPileTopCard(source);
+        for (unsigned destination = 0; destination < foundationPilesCount; ++destination)
+            if (canBeAddedOnFoundationPile(card, destination))
+                moves[movesCount++] = Move {
+                    MoveType::MoveTableauPileCardToFoundationPile, source, destination};
+    }
+}
+
+void MoveGenerator::generateStockPileToFoundationPilesMoves(
+    Moves& moves, unsigned& movesCount) const
+{
+    if (not isStockPileCardSelected())
+        return;
+
+    const auto& card = getSelectedStockPileCard();
+    for (unsigned destination = 0; destination < foundationPilesCount; ++destination)
+        if (canBeAddedOnFoundationPile(card, destination))
+            moves[movesCount++] = Move {
+                MoveType::MoveStockPileCardToFoundationPile, 0, destination};
+}
+
+void MoveGenerator::generateTableauPilesToTableauPilesMoves(
+    Moves& moves, unsigned& movesCount) const
+{
+    for (unsigned source = 0; source < tableauPilesCount; ++source) {
+        const auto uncoveredCardsCount = getTableauPileUncoveredCardsCount(source);
+        const auto sourceEnd = std::next(gameState.cards.begin(), pilesOffsets[source + 1]);
+
+        for (unsigned destination = 0; destination < tableauPilesCount; ++destination) {
+            if (destination == source)
+                continue;
+
+            for (unsigned quantity = 1; quantity <= uncoveredCardsCount; ++quantity)
+                if (canBeAddedOnTableauPile(*std::prev(sourceEnd, quantity), destination)) {
+                    moves[movesCount++] = Move {
+                        MoveType::MoveTableauPileCardsToTableauPile,
+                        source, destination, quantity};
+                    break;
+                }
+        }
+    }
+}
+
+void MoveGenerator::generateStockPileToTableauPilesMoves(
+    Moves& moves, unsigned& movesCount) const
+{
+    if (not isStockPileCardSelected())
+        return;
+
+    const auto& card = getSelectedStockPileCard();
+    for (unsigned destination = 0; destination < tableauPilesCount; ++destination)
+        if (canBeAddedOnTableauPile(card, destination))
+            moves[movesCount++] = Move {
+                MoveType::MoveStockPileCardToTableauPile, 0, destination};
+}
+
+void MoveGenerator::generateFoundationPilesToTableauPilesMoves(
+    Moves& moves, unsigned& movesCount) const
+{
+    for (unsigned source = 0; source < foundationPilesCount; ++source) {
+        const auto pileIndex = GameState::firstFoundationPileIndex + source;
+        if (getPileSize(pileIndex) == 0)
+            continue;
+
+        const auto& card = getPileTopCard(pileIndex);
+        for (unsigned destination = 0; destination < tableauPilesCount; ++destination)
+            if (canBeAddedOnTableauPile(card, destination))
+                moves[movesCount++] = Move {
+                    MoveType::MoveFoundationPileCardToTableauPile, source, destination};
+    }
+}
+
+void MoveGenerator::generateStockPileCardSelection(
+    Moves& moves, unsigned& movesCount) const
+{
+    if (getPileSize(GameState::stockPileIndex) > 0)
+        moves[movesCount++] = Move {MoveType::SelectNextStockPileCard};
+}
+
+bool MoveGenerator::isGameFinished() const {
+    const auto& sizes = gameState.foundationPilesSizes;
+    return std::accumulate(sizes.begin(), sizes.end(), 0u) == gameState.cards.size();
+}
+
+bool MoveGenerator::isStockPileCardSelected() const {
+    return gameState.stockPileSelectedCardIndex != GameState::noSelectedStockPileCard;
+}
+
+bool MoveGenerator::isTableauPileTopCardCovered(const unsigned id) const {
+    const auto size = getPileSize(id);
+    return size > 0 and size == gameState.tableauPilesTopCoveredCardPositions[id];
+}
+
+bool MoveGenerator::canBeAddedOnTableauPile(const Card& card, const unsigned id) const {
+    if (getPileSize(id) == 0)
+        return canBePlacedOnEmptyTableau(card);
+    return not isTableauPileTopCardCovered(id) and
+           canBePlacedOnTableauCard(card, getPileTopCard(id));
+}
+
+bool MoveGenerator::canBeAddedOnFoundationPile(const Card& card, const unsigned id) const {
+    const auto pileIndex = GameState::firstFoundationPileIndex + id;
+    if (getPileSize(pileIndex) == 0)
+        return canBePlacedOnEmptyFoundation(card);
+    return canFollowOnFoundation(card, getPileTopCard(pileIndex));
+}
+
+unsigned MoveGenerator::getPileSize(const unsigned index) const {
+    return pilesOffsets[index + 1] - pilesOffsets[index];
+}
+
+unsigned MoveGenerator::getTableauPileUncoveredCardsCount(const unsigned id) const {
+    return getPileSize(id) - gameState.tableauPilesTopCoveredCardPositions[id];
+}
+
+const Card& MoveGenerator::getPileTopCard(const unsigned index) const {
+    return gameState.cards[pilesOffsets[index + 1] - 1];
+}
+
+const Card& MoveGenerator::getSelectedStockPileCard() const {
+    return gameState.cards[pilesOffsets[GameState::stockPileIndex] +
+                           gameState.stockPileSelectedCardIndex];
+}
+
+}
@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include "moves/ReversibleMoves.h"
+
+namespace solitaire::moves {
+
+namespace {
+constexpr unsigned stockPileIndex {GameState::stockPileIndex};
+
+unsigned getFoundationPileIndex(const unsigned id) {
+    return GameState::firstFoundationPileIndex + id;
+}
+
+unsigned getPileSize(const GameState::PilesOffsets& offsets, const unsigned index) {
+    return offsets[index + 1] - offsets[index];
+}
+
+void changePileSize(GameState& gameState, const unsigned index, const int difference) {
+    if (index < GameState::firstFoundationPileIndex)
+        gameState.tableauPilesSizes[index] += difference;
+    else if (index < stockPileIndex)
+        gameState.foundationPilesSizes[index - GameState::firstFoundationPileIndex] +=
+            difference;
+}
+
+void moveCards(GameState& gameState,
+               const unsigned sourceIndex, const unsigned sourcePosition,
+               const unsigned quantity,
+               const unsigned destinationIndex, const unsigned destinationPosition)
+{
+    const auto offsets = gameState.getPilesOffsets();
+    const auto first = std::next(gameState.cards.begin(), offsets[sourceIndex] + sourcePosition);
+    const auto last = std::next(first, quantity);
+    const auto destination = std::next(gameState.cards.begin(),
+                                       offsets[destinationIndex] + destinationPosition);
+
+    if (destination <= first)
+        std::rotate(destination, first, last);
+    else
+        std::rotate(first, last, destination);
+
+    changePileSize(gameState, sourceIndex, -static_cast<int>(quantity));
+    changePileSize(gameState, destinationIndex, quantity);
+}
+
+void moveTopCards(GameState& gameState, const unsigned sourceIndex,
+                  const unsigned quantity, const unsigned destinationIndex)
+{
+    const auto offsets = gameState.getPilesOffsets();
+    moveCards(gameState, sourceIndex, getPileSize(offsets, sourceIndex) - quantity, quantity,
+              destinationIndex, getPileSize(offsets, destinationIndex));
+}
+
+void moveSelectedStockPileCard(GameState& gameState, const unsigned destinationIndex) {
+    auto& selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    const auto offsets = gameState.getPilesOffsets();
+
+    moveCards(gameState, stockPileIndex, selectedCardIndex, 1,
+              destinationIndex, getPileSize(offsets, destinationIndex));
+    selectedCardIndex = selectedCardIndex == 0 ?
+        GameState::noSelectedStockPileCard : selectedCardIndex - 1;
+}
+
+void moveCardBackToStockPile(GameState& gameState, const unsigned sourceIndex) {
+    auto& selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    const auto offsets = gameState.getPilesOffsets();
+
+    selectedCardIndex = selectedCardIndex == GameState::noSelectedStockPileCard ?
+        0 : selectedCardIndex + 1;
+    moveCards(gameState, sourceIndex, getPileSize(offsets, sourceIndex) - 1, 1,
+              stockPileIndex, selectedCardIndex);
+}
+
+void selectNextStockPileCard(GameState& gameState) {
+    auto& selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    const auto stockPileSize = getPileSize(gameState.getPilesOffsets(), stockPileIndex);
+
+    if (selectedCardIndex == GameState::noSelectedStockPileCard)
+        selectedCardIndex = 0;
+    else if (selectedCardIndex + 1u == stockPileSize)
+        selectedCardIndex = GameState::noSelectedStockPileCard;
+    else
+        ++selectedCardIndex;
+}
+
+void selectPreviousStockPileCard(GameState& gameState) {
+    auto& selectedCardIndex = gameState.stockPileSelectedCardIndex;
+    const auto stockPileSize = getPileSize(gameState.getPilesOffsets(), stockPileIndex);
+
+    if (selectedCardIndex == GameState::noSelectedStockPileCard)
+        selectedCardIndex = stockPileSize - 1;
+    else if (selectedCardIndex == 0)
+        selectedCardIndex = GameState::noSelectedStockPileCard;
+    else
+        --selectedCardIndex;
+}
+}
+
+void applyMove(GameState& gameState, const Move& move) {
+    switch (move.getType()) {
+        case MoveType::SelectNextStockPileCard:
+            selectNextStockPileCard(gameState);
+            break;
+        case MoveType::UncoverTableauPileTopCard:
+            --gameState.tableauPilesTopCoveredCardPositions[move.getSource()];
+            break;
+        case MoveType::MoveStockPileCardToTableauPile:
+            moveSelectedStockPileCard(gameState, move.getDestination());
+            break;
+        case MoveType::MoveStockPileCardToFoundationPile:
+            moveSelectedStockPileCard(gameState, getFoundationPileIndex(move.getDestination()));
+            break;
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            moveTopCards(gameState, move.getSource(), move.getQuantity(), move.getDestination());
+            break;
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            moveTopCards(gameState, move.getSource(), 1,
+                         getFoundationPileIndex(move.getDestination()));
+            break;
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            moveTopCards(gameState, getFoundationPileIndex(move.getSource()), 1,
+                         move.getDestination());
+            break;
+    }
+}
+
+void undoMove(GameState& gameState, const Move& move) {
+    switch (move.getType()) {
+        case MoveType::SelectNextStockPileCard:
+            selectPreviousStockPileCard(gameState);
+            break;
+        case MoveType::UncoverTableauPileTopCard:
+            ++gameState.tableauPilesTopCoveredCardPositions[move.getSource()];
+            break;
+        case MoveType::MoveStockPileCardToTableauPile:
+            moveCardBackToStockPile(gameState, move.getDestination());
+            break;
+        case MoveType::MoveStockPileCardToFoundationPile:
+            moveCardBackToStockPile(gameState, getFoundationPileIndex(move.getDestination()));
+            break;
+        case MoveType::MoveTableauPileCardsToTableauPile:
+            moveTopCards(gameState, move.getDestination(), move.getQuantity(), move.getSource());
+            break;
+        case MoveType::MoveTableauPileCardToFoundationPile:
+            moveTopCards(gameState, getFoundationPileIndex(move.getDestination()), 1,
+                         move.getSource());
+            break;
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            moveTopCards(gameState, move.getDestination(), 1,
+                         getFoundationPileIndex(move.getSource()));
+            break;
+    }
+}
+
+}
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "cards/CardPlacementRules.h"
+#include "piles/CardsJournal.h"
+
+using namespace solitaire::cards;
+
+namespace solitaire::piles {
+
+CardsJournal::Position CardsJournal::attachSnapshot() {
+    const auto position = getEndPosition();
+    snapshotsPositions.insert(
+        std::upper_bound(snapshotsPositions.begin(), snapshotsPositions.end(), position),
+        position);
+    return position;
+}
+
+void CardsJournal::detachSnapshot(const Position position) noexcept {
+    const auto snapshotPosition =
+        std::lower_bound(snapshotsPositions.begin(), snapshotsPositions.end(), position);
+
+    if (snapshotPosition == snapshotsPositions.end() or *snapshotPosition != position)
+        return;
+
+    snapshotsPositions.erase(snapshotPosition);
+    discardEntriesNotNeededBySnapshots();
+}
+
+void CardsJournal::recordAddedCard(const Card& card, const unsigned stackIndex) {
+    if (isRecording())
+        record(card, false, stackIndex);
+}
+
+void CardsJournal::recordRemovedCard(const Card& card, const unsigned stackIndex) {
+    if (isRecording())
+        record(card, true, stackIndex);
+}
+
+std::size_t CardsJournal::getEntriesCount() const {
+    return entriesCount;
+}
+
+std::size_t CardsJournal::getMemoryUsage() const {
+    return entries.capacity() * sizeof(std::uint8_t);
+}
+
+std::size_t CardsJournal::getMemoryUsagePinnedBy(const Position position) const {
+    auto pinnedEntriesEndPosition = getEndPosition();
+    if (not snapshotsPositions.empty() and snapshotsPositions.back() > position)
+        pinnedEntriesEndPosition = std::min(pinnedEntriesEndPosition,
+            *std::upper_bound(snapshotsPositions.begin(), snapshotsPositions.end(), position));
+
+    if (position >= pinnedEntriesEndPosition)
+        return 0;
+    return (pinnedEntriesEndPosition - position) * sizeof(std::uint8_t);
+}
+
+CardsJournal::Entry CardsJournal::decodeEntry(const std::uint8_t entry) {
+    return Entry {getCardFromCode(entry & cardCodeMask),
+                  (entry & removalMask) != 0,
+                  (entry & stackIndexMask) != 0 ? 1u : 0u};
+}
+
+bool CardsJournal::isRecording() const {
+    return not snapshotsPositions.empty();
+}
+
+void CardsJournal::record(const Card& card, const bool isRemoval,
+                          const unsigned stackIndex)
+{
+    if (entriesCount == entries.size())
+        growCapacity();
+
+    entries[getEntryIndex(entriesCount)] = card.getCode() |
+                                           (stackIndex != 0 ? stackIndexMask : 0) |
+                                           (isRemoval ? removalMask : 0);
+    ++entriesCount;
+}
+
+void CardsJournal::growCapacity() {
+    std::vector<std::uint8_t> grownEntries(std::max(initialCapacity, 2 * entries.size()));
+    for (std::size_t offset = 0; offset < entriesCount; ++offset)
+        grownEntries[offset] = entries[getEntryIndex(offset)];
+
+    entries = std::move(grownEntries);
+    firstEntryIndex = 0;
+}
+
+std::uint8_t CardsJournal::popLastEntry() {
+    --entriesCount;
+    return entries[getEntryIndex(entriesCount)];
+}
+
+std::size_t CardsJournal::getEntryIndex(const std::size_t offset) const {
+    return (firstEntryIndex + offset) & (entries.size() - 1);
+}
+
+CardsJournal::Position CardsJournal::getEndPosition() const {
+    return firstEntryPosition + entriesCount;
+}
+
+void CardsJournal::throwExceptionOnPositionNotInJournal(const Position position) const {
+    if (position < firstEntryPosition or position > getEndPosition())
+        throw std::runtime_error {"Position is not in cards journal: " +
+                                  std::to_string(position)};
+}
+
+void CardsJournal::discardEntriesNotNeededBySnapshots() noexcept {
+    if (snapshotsPositions.empty()) {
+        firstEntryPosition = getEndPosition();
+        firstEntryIndex = 0;
+        entriesCount = 0;
+        return;
+    }
+
+    const auto oldestSnapshotPosition = snapshotsPositions.front();
+    const auto entriesToDiscard =
+        std::min<Position>(oldestSnapshotPosition, getEndPosition()) - firstEntryPosition;
+
+    if (entriesToDiscard > 0) {
+        firstEntryIndex = getEntryIndex(entriesToDiscard);
+        entriesCount -= entriesToDiscard;
+        firstEntryPosition += entriesToDiscard;
+    }
+}
+
+}
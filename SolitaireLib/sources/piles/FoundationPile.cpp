@@ -1,56 +1,98 @@
 #include "cards/Card.h"
+#include "cards/CardPlacementRules.h"
 #include "cards/Value.h"
+#include "cards/ZobristKeys.h"
 #include "piles/FoundationPile.h"
 
+using namespace solitaire::archivers;
 using namespace solitaire::cards;
 
 namespace solitaire::piles {
 
+FoundationPile::FoundationPile():
+    FoundationPile {std::make_shared<SnapshotsPool>()} {
+}
+
+FoundationPile::FoundationPile(std::shared_ptr<SnapshotsPool> snapshotsPool):
+    snapshotsPool {std::move(snapshotsPool)} {
+}
+
 void FoundationPile::initialize() {
+    journal.recordRemovedCards(cards.rbegin(), cards.rend());
     cards.clear();
+    cardSet = CardSet {};
+    positionHash = 0;
+}
+
+void FoundationPile::initialize(const Deck::const_iterator& begin,
+                                const Deck::const_iterator& end)
+{
+    journal.recordRemovedCards(cards.rbegin(), cards.rend());
+    journal.recordAddedCards(begin, end);
+    cards.assign(begin, end);
+    cardSet = CardSet {begin, end};
+    positionHash = getZobristHash(begin, end, CardLocation::FoundationPile);
 }
 
 std::unique_ptr<archivers::interfaces::Snapshot> FoundationPile::createSnapshot() {
-    return std::make_unique<Snapshot>(shared_from_this(), cards);
+    static_assert(sizeof(Snapshot) <= SnapshotsPool::maxSnapshotSize);
+    return std::unique_ptr<archivers::interfaces::Snapshot> {
+        new (*snapshotsPool) Snapshot(shared_from_this(), cardSet, positionHash)
+    };
 }
 
 void FoundationPile::tryAddCard(std::optional<Card>& cardToAdd) {
-    if (shouldAddCard(cardToAdd)) {
+    if (cardToAdd and canAddCard(cardToAdd.value())) {
         cards.push_back(cardToAdd.value());
+        journal.recordAddedCard(cardToAdd.value());
+        cardSet.insert(cardToAdd.value());
+        positionHash ^= getZobristKey(CardLocation::FoundationPile, cardToAdd.value());
         cardToAdd.reset();
     }
 }
 
-bool FoundationPile::shouldAddCard(std::optional<Card>& cardToAdd) const {
-    if (not cardToAdd) return false;
-    if (cards.empty()) return isCardToAddAce(cardToAdd.value());
-    return isCardToAddCorrect(cardToAdd.value());
+bool FoundationPile::canAddCard(const Card& cardToAdd) const {
+    if (cards.empty()) return isCardToAddAce(cardToAdd);
+    return isCardToAddCorrect(cardToAdd);
 }
 
 bool FoundationPile::isCardToAddAce(const Card& cardToAdd) const {
-    return cardToAdd.getValue() == Value::Ace;
+    return canBePlacedOnEmptyFoundation(cardToAdd);
 }
 
 bool FoundationPile::isCardToAddCorrect(const Card& cardToAdd) const {
-    const Card& topPileCard = cards.back();
-    return cardToAdd.hasValueOneGreaterThan(topPileCard) and
-           cardToAdd.hasSameSuitAs(topPileCard);
+    return canFollowOnFoundation(cardToAdd, cards.back());
 }
 
 std::optional<Card> FoundationPile::tryPullOutCard() {
-    if (not cards.empty()) {
+    if (canPullOutCard()) {
         const auto pulledOutCard = cards.back();
         cards.pop_back();
+        journal.recordRemovedCard(pulledOutCard);
+        cardSet.erase(pulledOutCard);
+        positionHash ^= getZobristKey(CardLocation::FoundationPile, pulledOutCard);
         return pulledOutCard;
     }
 
     return std::nullopt;
 }
 
+bool FoundationPile::canPullOutCard() const {
+    return not cards.empty();
+}
+
 const Cards& FoundationPile::getCards() const {
     return cards;
 }
 
+CardSet FoundationPile::getCardSet() const {
+    return cardSet;
+}
+
+std::uint64_t FoundationPile::getPositionHash() const {
+    return positionHash;
+}
+
 std::optional<Value> FoundationPile::getTopCardValue() const {
     if (cards.empty())
         return std::nullopt;
@@ -58,24 +100,44 @@ std::optional<Value> FoundationPile::getTopCardValue() const {
 }
 
 FoundationPile::Snapshot::Snapshot(
-    std::shared_ptr<FoundationPile> foundationPile, Cards pileCards):
+    std::shared_ptr<FoundationPile> foundationPile, CardSet pileCardSet,
+    std::uint64_t positionHash):
     foundationPile {std::move(foundationPile)},
-    pileCards {std::move(pileCards)} {
+    journalPosition {this->foundationPile->journal.attachSnapshot()},
+    pileCardSet {pileCardSet},
+    positionHash {positionHash} {
+}
+
+FoundationPile::Snapshot::~Snapshot() {
+    foundationPile->journal.detachSnapshot(journalPosition);
 }
 
 void FoundationPile::Snapshot::restore() const {
-    foundationPile->cards = pileCards;
+    auto& pileCards = foundationPile->cards;
+    foundationPile->journal.rollBack(journalPosition,
+        [&pileCards](const CardsJournal::Entry& entry) {
+            if (entry.isRemoval)
+                pileCards.push_back(entry.card);
+            else
+                pileCards.pop_back();
+        });
+    foundationPile->cardSet = pileCardSet;
+    foundationPile->positionHash = positionHash;
 }
 
 bool FoundationPile::Snapshot::isSnapshotOfSameObject(
     const archivers::interfaces::Snapshot& snapshot) const
-try {
-    const auto& castedSnaphost =
-        dynamic_cast<const Snapshot&>(snapshot);
-    return foundationPile == castedSnaphost.foundationPile;
+{
+    return snapshot.getObjectKey() == getObjectKey();
+}
+
+const void* FoundationPile::Snapshot::getObjectKey() const {
+    return foundationPile.get();
 }
-catch (const std::bad_cast&) {
-    return false;
+
+std::size_t FoundationPile::Snapshot::getMemoryUsage() const {
+    return SnapshotsPool::getBlockSize() + sizeof(CardsJournal::Position) +
+           foundationPile->journal.getMemoryUsagePinnedBy(journalPosition);
 }
 
 }
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
 #include "cards/Card.h"
+#include "cards/ZobristKeys.h"
 #include "piles/StockPile.h"
 
 using namespace solitaire::archivers;
@@ -6,75 +11,200 @@ using namespace solitaire::cards;
 
 namespace solitaire::piles {
 
+StockPile::StockPile():
+    StockPile {std::make_shared<SnapshotsPool>()} {
+}
+
+StockPile::StockPile(std::shared_ptr<SnapshotsPool> snapshotsPool):
+    snapshotsPool {std::move(snapshotsPool)} {
+}
+
 void StockPile::initialize(const Deck::const_iterator& begin,
                            const Deck::const_iterator& end)
 {
-    cards.assign(begin, end);
-    selectedCardIndex.reset();
+    initialize(begin, end, std::nullopt);
+}
+
+void StockPile::initialize(const Deck::const_iterator& begin,
+                           const Deck::const_iterator& end,
+                           const std::optional<unsigned> selectedCardIndex)
+{
+    const unsigned cardsCount = std::distance(begin, end);
+    if (selectedCardIndex and selectedCardIndex.value() >= cardsCount)
+        throw std::runtime_error {"Invalid selected card index: " +
+                                  std::to_string(selectedCardIndex.value())};
+
+    const auto firstStockCard =
+        selectedCardIndex ? std::next(begin, selectedCardIndex.value() + 1) : begin;
+
+    journal.recordRemovedCards(wasteCards.rbegin(), wasteCards.rend(), wasteCardsJournalIndex);
+    journal.recordRemovedCards(stockCards.rbegin(), stockCards.rend(), stockCardsJournalIndex);
+    journal.recordAddedCards(begin, firstStockCard, wasteCardsJournalIndex);
+    journal.recordAddedCards(std::make_reverse_iterator(end),
+                             std::make_reverse_iterator(firstStockCard),
+                             stockCardsJournalIndex);
+    wasteCards.assign(begin, firstStockCard);
+    stockCards.assign(std::make_reverse_iterator(end),
+                      std::make_reverse_iterator(firstStockCard));
+    cardSet = CardSet {begin, end};
+    positionHash = getZobristHash(begin, firstStockCard, CardLocation::StockPileWaste) ^
+                   getZobristHash(firstStockCard, end, CardLocation::StockPileStock);
+    areCardsUpToDate = false;
 }
 
 std::unique_ptr<archivers::interfaces::Snapshot> StockPile::createSnapshot() {
-    return std::make_unique<Snapshot>(shared_from_this(), cards, selectedCardIndex);
+    static_assert(sizeof(Snapshot) <= SnapshotsPool::maxSnapshotSize);
+    return std::unique_ptr<archivers::interfaces::Snapshot> {
+        new (*snapshotsPool) Snapshot(shared_from_this(), cardSet, positionHash)
+    };
 }
 
 void StockPile::trySelectNextCard() {
-    incrementSelectedCardIndex();
-    if (selectedCardIndex == cards.size())
-        selectedCardIndex.reset();
+    if (stockCards.empty())
+        moveWasteCardsBackToStock();
+    else {
+        journal.recordRemovedCard(stockCards.back(), stockCardsJournalIndex);
+        journal.recordAddedCard(stockCards.back(), wasteCardsJournalIndex);
+        toggleWasteCardPositionHash(stockCards.back());
+        wasteCards.push_back(stockCards.back());
+        stockCards.pop_back();
+    }
+}
+
+void StockPile::moveWasteCardsBackToStock() {
+    for (auto card = wasteCards.rbegin(); card != wasteCards.rend(); ++card) {
+        journal.recordRemovedCard(*card, wasteCardsJournalIndex);
+        journal.recordAddedCard(*card, stockCardsJournalIndex);
+        toggleWasteCardPositionHash(*card);
+    }
+
+    stockCards.insert(stockCards.end(), wasteCards.rbegin(), wasteCards.rend());
+    wasteCards.clear();
+    areCardsUpToDate = false;
+}
+
+void StockPile::trySelectPreviousCard() {
+    if (wasteCards.empty())
+        moveStockCardsBackToWaste();
+    else {
+        journal.recordRemovedCard(wasteCards.back(), wasteCardsJournalIndex);
+        journal.recordAddedCard(wasteCards.back(), stockCardsJournalIndex);
+        toggleWasteCardPositionHash(wasteCards.back());
+        stockCards.push_back(wasteCards.back());
+        wasteCards.pop_back();
+    }
+}
+
+void StockPile::moveStockCardsBackToWaste() {
+    for (auto card = stockCards.rbegin(); card != stockCards.rend(); ++card) {
+        journal.recordRemovedCard(*card, stockCardsJournalIndex);
+        journal.recordAddedCard(*card, wasteCardsJournalIndex);
+        toggleWasteCardPositionHash(*card);
+    }
+
+    wasteCards.insert(wasteCards.end(), stockCards.rbegin(), stockCards.rend());
+    stockCards.clear();
+    areCardsUpToDate = false;
+}
+
+void StockPile::toggleWasteCardPositionHash(const Card& card) {
+    positionHash ^= getZobristKey(CardLocation::StockPileStock, card) ^
+                    getZobristKey(CardLocation::StockPileWaste, card);
 }
 
 std::optional<Card> StockPile::tryPullOutCard() {
-    if (selectedCardIndex) {
-        const auto pulledOutCard = cards.at(selectedCardIndex.value());
-        cards.erase(std::next(cards.begin(), selectedCardIndex.value()));
-        decrementSelectedCardIndex();
+    if (canPullOutCard()) {
+        const auto pulledOutCard = wasteCards.back();
+        wasteCards.pop_back();
+        journal.recordRemovedCard(pulledOutCard, wasteCardsJournalIndex);
+        cardSet.erase(pulledOutCard);
+        positionHash ^= getZobristKey(CardLocation::StockPileWaste, pulledOutCard);
+        areCardsUpToDate = false;
         return pulledOutCard;
     }
 
     return std::nullopt;
 }
 
-void StockPile::incrementSelectedCardIndex() {
-    selectedCardIndex = selectedCardIndex ? selectedCardIndex.value() + 1 : 0;
+void StockPile::putBackCard(const Card& card) {
+    wasteCards.push_back(card);
+    journal.recordAddedCard(card, wasteCardsJournalIndex);
+    cardSet.insert(card);
+    positionHash ^= getZobristKey(CardLocation::StockPileWaste, card);
+    areCardsUpToDate = false;
 }
 
-void StockPile::decrementSelectedCardIndex() {
-    if (selectedCardIndex > 0u)
-        --selectedCardIndex.value();
-    else
-        selectedCardIndex.reset();
+bool StockPile::canPullOutCard() const {
+    return not wasteCards.empty();
 }
 
 const Cards& StockPile::getCards() const {
+    if (not areCardsUpToDate) {
+        cards = wasteCards;
+        cards.insert(cards.end(), stockCards.rbegin(), stockCards.rend());
+        areCardsUpToDate = true;
+    }
+
     return cards;
 }
 
+CardSet StockPile::getCardSet() const {
+    return cardSet;
+}
+
+std::uint64_t StockPile::getPositionHash() const {
+    return positionHash;
+}
+
 std::optional<unsigned> StockPile::getSelectedCardIndex() const {
-    return selectedCardIndex;
+    if (wasteCards.empty())
+        return std::nullopt;
+    return wasteCards.size() - 1;
 }
 
 StockPile::Snapshot::Snapshot(
-    std::shared_ptr<StockPile> stockPile, Cards pileCards,
-    std::optional<unsigned> selectedCardIndex):
+    std::shared_ptr<StockPile> stockPile, CardSet pileCardSet, std::uint64_t positionHash):
     stockPile {std::move(stockPile)},
-    pileCards {std::move(pileCards)},
-    selectedCardIndex {std::move(selectedCardIndex)} {
+    journalPosition {this->stockPile->journal.attachSnapshot()},
+    pileCardSet {pileCardSet},
+    positionHash {positionHash} {
+}
+
+StockPile::Snapshot::~Snapshot() {
+    stockPile->journal.detachSnapshot(journalPosition);
 }
 
 void StockPile::Snapshot::restore() const {
-    stockPile->cards = pileCards;
-    stockPile->selectedCardIndex = selectedCardIndex;
+    auto& pileStockCards = stockPile->stockCards;
+    auto& pileWasteCards = stockPile->wasteCards;
+    stockPile->journal.rollBack(journalPosition,
+        [&pileStockCards, &pileWasteCards](const CardsJournal::Entry& entry) {
+            auto& pileCards = entry.stackIndex == stockCardsJournalIndex ?
+                pileStockCards : pileWasteCards;
+
+            if (entry.isRemoval)
+                pileCards.push_back(entry.card);
+            else
+                pileCards.pop_back();
+        });
+    stockPile->cardSet = pileCardSet;
+    stockPile->positionHash = positionHash;
+    stockPile->areCardsUpToDate = false;
 }
 
 bool StockPile::Snapshot::isSnapshotOfSameObject(
     const archivers::interfaces::Snapshot& snapshot) const
-try {
-    const auto& castedSnaphost =
-        dynamic_cast<const Snapshot&>(snapshot);
-    return stockPile == castedSnaphost.stockPile;
+{
+    return snapshot.getObjectKey() == getObjectKey();
+}
+
+const void* StockPile::Snapshot::getObjectKey() const {
+    return stockPile.get();
 }
-catch (const std::bad_cast&) {
-    return false;
+
+std::size_t StockPile::Snapshot::getMemoryUsage() const {
+    return SnapshotsPool::getBlockSize() + sizeof(CardsJournal::Position) +
+           stockPile->journal.getMemoryUsagePinnedBy(journalPosition);
 }
 
 }
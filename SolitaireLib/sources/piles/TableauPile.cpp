@@ -1,5 +1,10 @@
+#include <stdexcept>
+#include <string>
+
 #include "cards/Card.h"
-#include "cards/Value.h"
+#include "cards/CardPlacementRules.h"
+#include "cards/ZobristKeys.h"
+#include "interfaces/piles/FoundationPile.h"
 #include "piles/TableauPile.h"
 
 using namespace solitaire::archivers;
@@ -7,52 +12,114 @@ using namespace solitaire::cards;
 
 namespace solitaire::piles {
 
+TableauPile::TableauPile():
+    TableauPile {std::make_shared<SnapshotsPool>()} {
+}
+
+TableauPile::TableauPile(std::shared_ptr<SnapshotsPool> snapshotsPool):
+    snapshotsPool {std::move(snapshotsPool)} {
+}
+
 void TableauPile::initialize(const Deck::const_iterator& begin,
                              const Deck::const_iterator& end) {
+    const unsigned cardsCount = std::distance(begin, end);
+    initialize(begin, end, cardsCount == 0 ? 0 : cardsCount - 1);
+}
+
+void TableauPile::initialize(const Deck::const_iterator& begin,
+                             const Deck::const_iterator& end,
+                             const unsigned topCoveredCardPosition)
+{
+    const unsigned cardsCount = std::distance(begin, end);
+    if (topCoveredCardPosition > cardsCount)
+        throw std::runtime_error {"Invalid top covered card position: " +
+                                  std::to_string(topCoveredCardPosition)};
+
+    journal.recordRemovedCards(cards.rbegin(), cards.rend());
+    journal.recordAddedCards(begin, end);
     cards.assign(begin, end);
-    topCoveredCardPosition = cards.empty() ? 0 : cards.size() - 1;
+    this->topCoveredCardPosition = topCoveredCardPosition;
+    cardSet = CardSet {begin, end};
+    coveredCardSet = CardSet {begin, std::next(begin, topCoveredCardPosition)};
+    positionHash =
+        getZobristHash(begin, std::next(begin, topCoveredCardPosition),
+                       CardLocation::TableauPileCovered) ^
+        getZobristHash(std::next(begin, topCoveredCardPosition), end,
+                       CardLocation::TableauPileUncovered);
 }
 
 std::unique_ptr<archivers::interfaces::Snapshot> TableauPile::createSnapshot() {
-    return std::make_unique<Snapshot>(shared_from_this(), cards,
-                                      topCoveredCardPosition);
+    static_assert(sizeof(Snapshot) <= SnapshotsPool::maxSnapshotSize);
+    return std::unique_ptr<archivers::interfaces::Snapshot> {
+        new (*snapshotsPool) Snapshot(shared_from_this(), cardSet, coveredCardSet,
+                                      topCoveredCardPosition, positionHash)
+    };
 }
 
 void TableauPile::tryUncoverTopCard() {
-    if (isTopCardCovered())
-        --topCoveredCardPosition;
+    if (isTopCardCovered()) {
+        const auto& card = cards[--topCoveredCardPosition];
+        coveredCardSet.erase(card);
+        positionHash ^= getZobristKey(CardLocation::TableauPileCovered, card) ^
+                        getZobristKey(CardLocation::TableauPileUncovered, card);
+    }
+}
+
+void TableauPile::tryCoverTopCard() {
+    if (cards.size() == topCoveredCardPosition + 1) {
+        const auto& card = cards[topCoveredCardPosition++];
+        coveredCardSet.insert(card);
+        positionHash ^= getZobristKey(CardLocation::TableauPileCovered, card) ^
+                        getZobristKey(CardLocation::TableauPileUncovered, card);
+    }
 }
 
 void TableauPile::tryAddCards(Cards& cardsToAdd) {
-    if (shouldAddCards(cardsToAdd)) {
-        cards.insert(cards.end(), cardsToAdd.begin(), cardsToAdd.end());
+    if (tryAddCards(cardsToAdd.begin(), cardsToAdd.end()))
         cardsToAdd.clear();
+}
+
+bool TableauPile::tryAddCards(const Cards::const_iterator firstCardToAdd,
+                              const Cards::const_iterator lastCardToAdd)
+{
+    if (canAddCards(firstCardToAdd, lastCardToAdd)) {
+        appendCards(firstCardToAdd, lastCardToAdd);
+        return true;
     }
+
+    return false;
 }
 
-bool TableauPile::shouldAddCards(const Cards& cardsToAdd) const {
-    if (cardsToAdd.empty() or isTopCardCovered()) return false;
-    if (cards.empty()) return isFirstCardToAddKing(cardsToAdd);
-    return isFirstCardToAddCorrect(cardsToAdd);
+void TableauPile::appendCards(const Cards::const_iterator firstCardToAppend,
+                              const Cards::const_iterator lastCardToAppend)
+{
+    journal.recordAddedCards(firstCardToAppend, lastCardToAppend);
+    cards.insert(cards.end(), firstCardToAppend, lastCardToAppend);
+    cardSet.insert(firstCardToAppend, lastCardToAppend);
+    positionHash ^= getZobristHash(firstCardToAppend, lastCardToAppend,
+                                   CardLocation::TableauPileUncovered);
 }
 
-bool TableauPile::isFirstCardToAddKing(const Cards& cardsToAdd) const {
-    return cardsToAdd.front().getValue() == Value::King;
+bool TableauPile::canAddCards(const Cards::const_iterator firstCardToAdd,
+                              const Cards::const_iterator lastCardToAdd) const
+{
+    if (firstCardToAdd == lastCardToAdd or isTopCardCovered()) return false;
+    if (cards.empty()) return isFirstCardToAddKing(*firstCardToAdd);
+    return isFirstCardToAddCorrect(*firstCardToAdd);
 }
 
-bool TableauPile::isFirstCardToAddCorrect(const Cards& cardsToAdd) const {
-    const Card& topPileCard = cards.back();
-    const Card& firstCardToAdd = cardsToAdd.front();
+bool TableauPile::isFirstCardToAddKing(const Card& firstCardToAdd) const {
+    return canBePlacedOnEmptyTableau(firstCardToAdd);
+}
 
-    return topPileCard.hasValueOneGreaterThan(firstCardToAdd) and
-           topPileCard.hasDifferentColorThan(firstCardToAdd);
+bool TableauPile::isFirstCardToAddCorrect(const Card& firstCardToAdd) const {
+    return canBePlacedOnTableauCard(firstCardToAdd, cards.back());
 }
 
 Cards TableauPile::tryPullOutCards(unsigned quantity) {
     if (shouldPullOutCards(quantity)) {
-        const auto firstCardToPullOut = std::prev(cards.end(), quantity);
-        const Cards pulledOutCards {firstCardToPullOut, cards.end()};
-        cards.erase(firstCardToPullOut, cards.end());
+        const Cards pulledOutCards {std::prev(cards.end(), quantity), cards.end()};
+        removeTopCards(quantity);
         return pulledOutCards;
     }
 
@@ -63,10 +130,68 @@ bool TableauPile::shouldPullOutCards(unsigned quantity) const {
     return cards.size() - topCoveredCardPosition >= quantity;
 }
 
+bool TableauPile::tryMoveCards(unsigned quantity,
+                               interfaces::TableauPile& destinationPile)
+{
+    if (canPullOutCards(quantity) and &destinationPile != this and
+        destinationPile.tryAddCards(std::prev(cards.end(), quantity), cards.end()))
+    {
+        removeTopCards(quantity);
+        return true;
+    }
+
+    return false;
+}
+
+bool TableauPile::tryMoveTopCard(interfaces::FoundationPile& destinationPile) {
+    if (canPullOutCards(1)) {
+        std::optional<Card> cardToAdd {cards.back()};
+        destinationPile.tryAddCard(cardToAdd);
+
+        if (not cardToAdd) {
+            removeTopCards(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TableauPile::putBackCards(const Cards::const_iterator firstCardToPutBack,
+                               const Cards::const_iterator lastCardToPutBack)
+{
+    appendCards(firstCardToPutBack, lastCardToPutBack);
+}
+
+bool TableauPile::canPullOutCards(unsigned quantity) const {
+    return quantity > 0 and shouldPullOutCards(quantity);
+}
+
+void TableauPile::removeTopCards(unsigned quantity) {
+    const auto firstCardToRemove = std::prev(cards.end(), quantity);
+    journal.recordRemovedCards(cards.rbegin(), std::make_reverse_iterator(firstCardToRemove));
+    cardSet.erase(firstCardToRemove, cards.end());
+    positionHash ^= getZobristHash(firstCardToRemove, cards.end(),
+                                   CardLocation::TableauPileUncovered);
+    cards.erase(firstCardToRemove, cards.end());
+}
+
 const Cards& TableauPile::getCards() const {
     return cards;
 }
 
+CardSet TableauPile::getCardSet() const {
+    return cardSet;
+}
+
+std::uint64_t TableauPile::getPositionHash() const {
+    return positionHash;
+}
+
+CardSet TableauPile::getCoveredCardSet() const {
+    return coveredCardSet;
+}
+
 unsigned TableauPile::getTopCoveredCardPosition() const {
     return topCoveredCardPosition;
 }
@@ -76,27 +201,48 @@ bool TableauPile::isTopCardCovered() const {
 }
 
 TableauPile::Snapshot::Snapshot(
-    std::shared_ptr<TableauPile> tableauPile,
-    Cards pileCards, unsigned topCoveredCardPosition):
+    std::shared_ptr<TableauPile> tableauPile, CardSet pileCardSet,
+    CardSet coveredCardSet, unsigned topCoveredCardPosition, std::uint64_t positionHash):
     tableauPile {std::move(tableauPile)},
-    pileCards {std::move(pileCards)},
-    topCoveredCardPosition {std::move(topCoveredCardPosition)} {
+    journalPosition {this->tableauPile->journal.attachSnapshot()},
+    pileCardSet {pileCardSet},
+    coveredCardSet {coveredCardSet},
+    topCoveredCardPosition {std::move(topCoveredCardPosition)},
+    positionHash {positionHash} {
+}
+
+TableauPile::Snapshot::~Snapshot() {
+    tableauPile->journal.detachSnapshot(journalPosition);
 }
 
 void TableauPile::Snapshot::restore() const {
-    tableauPile->cards = pileCards;
+    auto& pileCards = tableauPile->cards;
+    tableauPile->journal.rollBack(journalPosition,
+        [&pileCards](const CardsJournal::Entry& entry) {
+            if (entry.isRemoval)
+                pileCards.push_back(entry.card);
+            else
+                pileCards.pop_back();
+        });
+    tableauPile->cardSet = pileCardSet;
+    tableauPile->coveredCardSet = coveredCardSet;
     tableauPile->topCoveredCardPosition = topCoveredCardPosition;
+    tableauPile->positionHash = positionHash;
 }
 
 bool TableauPile::Snapshot::isSnapshotOfSameObject(
     const archivers::interfaces::Snapshot& snapshot) const
-try {
-    const auto& castedSnaphost =
-        dynamic_cast<const Snapshot&>(snapshot);
-    return tableauPile == castedSnaphost.tableauPile;
+{
+    return snapshot.getObjectKey() == getObjectKey();
 }
-catch (const std::bad_cast&) {
-    return false;
+
+const void* TableauPile::Snapshot::getObjectKey() const {
+    return tableauPile.get();
+}
+
+std::size_t TableauPile::Snapshot::getMemoryUsage() const {
+    return SnapshotsPool::getBlockSize() + sizeof(CardsJournal::Position) +
+           tableauPile->journal.getMemoryUsagePinnedBy(journalPosition);
 }
 
 }
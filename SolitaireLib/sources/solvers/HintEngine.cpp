@@ -0,0 +1,71 @@
+#include "interfaces/Solitaire.h"
+#include "solvers/HintEngine.h"
+
+using namespace solitaire::moves;
+
+namespace solitaire::solvers {
+
+HintEngine::HintEngine(const SolverLimits& limits):
+    solver {limits},
+    worker {&HintEngine::analyzePositionsInBackground, this} {
+}
+
+HintEngine::~HintEngine() {
+    {
+        std::lock_guard lock {mutex};
+        stopped = true;
+        solver.cancel();
+    }
+    positionChanged.notify_one();
+    worker.join();
+}
+
+void HintEngine::analyzePosition(const solitaire::interfaces::Solitaire& solitaire) {
+    isHintVisible = solitaire.getCardsInHand().empty();
+    if (not isHintVisible)
+        return;
+
+    const auto positionHash = solitaire.getPositionHash();
+    if (positionHash == analyzedPositionHash)
+        return;
+
+    analyzedPositionHash = positionHash;
+    {
+        std::lock_guard lock {mutex};
+        positionToAnalyze = solitaire.exportGameState();
+        hint.reset();
+        solver.cancel();
+    }
+    positionChanged.notify_one();
+}
+
+std::optional<Move> HintEngine::getHint() const {
+    if (not isHintVisible)
+        return std::nullopt;
+
+    std::lock_guard lock {mutex};
+    return hint;
+}
+
+void HintEngine::analyzePositionsInBackground() {
+    while (true) {
+        std::unique_lock lock {mutex};
+        positionChanged.wait(lock, [this] { return stopped or positionToAnalyze; });
+        if (stopped)
+            return;
+
+        const auto position = positionToAnalyze.value();
+        positionToAnalyze.reset();
+        const auto generation = solver.getGeneration();
+        lock.unlock();
+
+        const auto result = solver.solve(position, generation);
+
+        lock.lock();
+        if (not positionToAnalyze and result.status == SolverStatus::Solved and
+            not result.moves.empty())
+            hint = result.moves.front();
+    }
+}
+
+}
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "moves/ReversibleMoves.h"
+#include "solvers/Solver.h"
+
+using namespace solitaire::cards;
+using namespace solitaire::moves;
+
+namespace solitaire::solvers {
+
+namespace {
+constexpr std::uint64_t timeLimitCheckInterval {1024};
+
+bool isGameFinished(const GameState& gameState) {
+    const auto& sizes = gameState.foundationPilesSizes;
+    return std::accumulate(sizes.begin(), sizes.end(), 0u) == gameState.cards.size();
+}
+
+bool isMovingCardsToEmptyTableauPile(const GameState& gameState, const Move& move) {
+    switch (move.getType()) {
+        case MoveType::MoveStockPileCardToTableauPile:
+        case MoveType::MoveTableauPileCardsToTableauPile:
+        case MoveType::MoveFoundationPileCardToTableauPile:
+            return gameState.tableauPilesSizes[move.getDestination()] == 0;
+        default:
+            return false;
+    }
+}
+
+bool isMovingWholeTableauPileToEmptyTableauPile(const GameState& gameState,
+                                                const Move& move)
+{
+    return move.getType() == MoveType::MoveTableauPileCardsToTableauPile and
+           gameState.tableauPilesSizes[move.getSource()] == move.getQuantity() and
+           gameState.tableauPilesSizes[move.getDestination()] == 0;
+}
+
+const Card& getMovedToFoundationCard(const GameState& gameState,
+                                     const GameState::PilesOffsets& pilesOffsets,
+                                     const Move& move)
+{
+    if (move.getType() == MoveType::MoveStockPileCardToFoundationPile)
+        return gameState.cards[pilesOffsets[GameState::stockPileIndex] +
+                               gameState.stockPileSelectedCardIndex];
+    return gameState.cards[pilesOffsets[move.getSource() + 1] - 1];
+}
+
+bool isSafeMoveToFoundationPile(const GameState& gameState, const Move& move) {
+    if (move.getType() != MoveType::MoveTableauPileCardToFoundationPile and
+        move.getType() != MoveType::MoveStockPileCardToFoundationPile)
+        return false;
+
+    const auto pilesOffsets = gameState.getPilesOffsets();
+    std::array<int, 4> foundationCardsCountsBySuit {};
+    for (unsigned id = 0; id < interfaces::Solitaire::foundationPilesCount; ++id) {
+        const auto pileIndex = GameState::firstFoundationPileIndex + id;
+        if (gameState.foundationPilesSizes[id] > 0)
+            foundationCardsCountsBySuit[to_int(
+                gameState.cards[pilesOffsets[pileIndex]].getSuit())] =
+                    gameState.foundationPilesSizes[id];
+    }
+
+    const auto& card = getMovedToFoundationCard(gameState, pilesOffsets, move);
+    const auto value = to_int(card.getValue());
+    if (value <= to_int(Value::Two))
+        return true;
+
+    for (const auto suit: {Suit::Heart, Suit::Spade, Suit::Diamond, Suit::Club})
+        if (card.hasDifferentColorThan(Card {Value::Ace, suit}) and
+            foundationCardsCountsBySuit[to_int(suit)] < value)
+            return false;
+    return true;
+}
+}
+
+Solver::Solver(const SolverLimits& limits):
+    limits {limits},
+    transpositionTable {limits.transpositionTableSizeLog2} {
+}
+
+SolverResult Solver::solve(const Deck& deck) {
+    return solve(GameState::fromDeck(deck));
+}
+
+SolverResult Solver::solve(const GameState& gameState) {
+    return solve(gameState, getGeneration());
+}
+
+SolverResult Solver::solve(const GameState& initialGameState,
+                           const std::uint64_t generation)
+{
+    searchGeneration = generation;
+    startTime = std::chrono::steady_clock::now();
+    nodesCount = 0;
+    transpositionTable.clear();
+    searchNodes.clear();
+
+    if (isGameFinished(initialGameState))
+        return SolverResult {SolverStatus::Solved, {}, nodesCount};
+
+    auto gameState = initialGameState;
+    transpositionTable.tryInsert(gameState.getPositionHash());
+    pushSearchNode(gameState);
+
+    while (not searchNodes.empty()) {
+        auto& searchNode = searchNodes.back();
+        if (searchNode.nextMoveIndex == searchNode.movesCount) {
+            searchNodes.pop_back();
+            if (not searchNodes.empty()) {
+                const auto& parentNode = searchNodes.back();
+                undoMove(gameState, parentNode.moves[parentNode.nextMoveIndex - 1]);
+            }
+            continue;
+        }
+
+        const auto move = searchNode.moves[searchNode.nextMoveIndex++];
+        applyMove(gameState, move);
+        if (isGameFinished(gameState))
+            return SolverResult {SolverStatus::Solved, collectPlayedMoves(), ++nodesCount};
+
+        if (not transpositionTable.tryInsert(gameState.getPositionHash())) {
+            undoMove(gameState, move);
+            continue;
+        }
+
+        ++nodesCount;
+        SolverStatus status;
+        if (isLimitReached(status))
+            return SolverResult {status, {}, nodesCount};
+
+        pushSearchNode(gameState);
+    }
+
+    return SolverResult {SolverStatus::Unsolvable, {}, nodesCount};
+}
+
+std::uint64_t Solver::getGeneration() const {
+    return generation.load();
+}
+
+void Solver::cancel() {
+    ++generation;
+}
+
+void Solver::pushSearchNode(const GameState& gameState) {
+    auto& searchNode = searchNodes.emplace_back();
+    const auto movesCount = MoveGenerator {gameState}.generate(searchNode.moves);
+    searchNode.movesCount = filterMoves(gameState, searchNode.moves, movesCount);
+    searchNode.nextMoveIndex = 0;
+}
+
+bool Solver::isLimitReached(SolverStatus& status) const {
+    if (generation.load(std::memory_order_relaxed) != searchGeneration)
+        status = SolverStatus::Cancelled;
+    else if (nodesCount >= limits.maxNodesCount)
+        status = SolverStatus::NodesLimitReached;
+    else if (limits.maxTime != std::chrono::milliseconds::zero() and
+             nodesCount % timeLimitCheckInterval == 0 and
+             std::chrono::steady_clock::now() - startTime >= limits.maxTime)
+        status = SolverStatus::TimeLimitReached;
+    else
+        return false;
+    return true;
+}
+
+std::vector<Move> Solver::collectPlayedMoves() const {
+    std::vector<Move> playedMoves;
+    playedMoves.reserve(searchNodes.size());
+    for (const auto& searchNode: searchNodes)
+        playedMoves.push_back(searchNode.moves[searchNode.nextMoveIndex - 1]);
+    return playedMoves;
+}
+
+unsigned Solver::filterMoves(const GameState& gameState, MoveGenerator::Moves& moves,
+                             const unsigned movesCount)
+{
+    const auto movesEnd = std::next(moves.begin(), movesCount);
+
+    const auto forcedMove = std::find_if(moves.begin(), movesEnd, [&](const auto& move) {
+        return move.getType() == MoveType::UncoverTableauPileTopCard or
+               isSafeMoveToFoundationPile(gameState, move);
+    });
+    if (forcedMove != movesEnd) {
+        moves.front() = *forcedMove;
+        return 1;
+    }
+
+    std::optional<Move> lastMoveToEmptyTableauPile;
+    const auto filteredMovesEnd = std::remove_if(moves.begin(), movesEnd, [&](const auto& move) {
+        if (isMovingWholeTableauPileToEmptyTableauPile(gameState, move))
+            return true;
+        if (not isMovingCardsToEmptyTableauPile(gameState, move))
+            return false;
+
+        const auto isSymmetricToLastMove = lastMoveToEmptyTableauPile and
+            lastMoveToEmptyTableauPile->getType() == move.getType() and
+            lastMoveToEmptyTableauPile->getSource() == move.getSource();
+        lastMoveToEmptyTableauPile = move;
+        return isSymmetricToLastMove;
+    });
+    return std::distance(moves.begin(), filteredMovesEnd);
+}
+
+}
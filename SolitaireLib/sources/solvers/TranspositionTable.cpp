@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "solvers/TranspositionTable.h"
+
+namespace solitaire::solvers {
+
+namespace {
+constexpr std::uint64_t emptyEntry {0};
+constexpr unsigned maxSizeLog2 {32};
+constexpr unsigned replacedEntryShift {62};
+}
+
+TranspositionTable::TranspositionTable(const unsigned sizeLog2):
+    bucketsMask {(std::size_t {1} << std::max(sizeLog2, 2u)) / bucketSize - 1}
+{
+    if (sizeLog2 > maxSizeLog2)
+        throw std::runtime_error {
+            "Transposition table size exceeds 2^" + std::to_string(maxSizeLog2)};
+
+    entries.resize((bucketsMask + 1) * bucketSize, emptyEntry);
+}
+
+bool TranspositionTable::tryInsert(const std::uint64_t hash) {
+    const auto entry = toEntry(hash);
+    const auto bucketBegin = getBucketBegin(hash);
+
+    for (auto index = bucketBegin; index < bucketBegin + bucketSize; ++index) {
+        if (entries[index] == entry)
+            return false;
+        if (not isFromCurrentGeneration(entries[index])) {
+            entries[index] = entry;
+            return true;
+        }
+    }
+
+    entries[bucketBegin + (hash >> replacedEntryShift) % bucketSize] = entry;
+    return true;
+}
+
+bool TranspositionTable::contains(const std::uint64_t hash) const {
+    const auto entry = toEntry(hash);
+    const auto bucketBegin = entries.begin() + getBucketBegin(hash);
+    return std::find(bucketBegin, bucketBegin + bucketSize, entry) != bucketBegin + bucketSize;
+}
+
+void TranspositionTable::clear() {
+    if (++generation > maxGeneration) {
+        std::fill(entries.begin(), entries.end(), emptyEntry);
+        generation = 1;
+    }
+}
+
+std::size_t TranspositionTable::getCapacity() const {
+    return entries.size();
+}
+
+std::uint64_t TranspositionTable::toEntry(const std::uint64_t hash) const {
+    const auto hashMask = (std::uint64_t {1} << generationShift) - 1;
+    return (hash & hashMask) | generation << generationShift;
+}
+
+bool TranspositionTable::isFromCurrentGeneration(const std::uint64_t entry) const {
+    return entry >> generationShift == generation;
+}
+
+std::size_t TranspositionTable::getBucketBegin(const std::uint64_t hash) const {
+    return (hash & bucketsMask) * bucketSize;
+}
+
+}
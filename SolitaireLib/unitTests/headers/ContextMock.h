@@ -3,6 +3,7 @@
 #include "geometry/Position.h"
 #include "gmock/gmock.h"
 #include "interfaces/Context.h"
+#include "interfaces/solvers/HintEngine.h"
 #include "piles/PileId.h"
 
 namespace solitaire {
@@ -39,6 +40,9 @@ public:
     MOCK_METHOD(interfaces::Button&, getUndoButton, (), (override));
     MOCK_METHOD(const interfaces::Button&, getUndoButton, (), (const, override));
 
+    MOCK_METHOD(solvers::interfaces::HintEngine&, getHintEngine, (), (override));
+    MOCK_METHOD(const solvers::interfaces::HintEngine&, getHintEngine, (), (const, override));
+
     MOCK_METHOD(geometry::Position, getMousePosition, (), (const, override));
     MOCK_METHOD(geometry::Position, getCardsInHandPosition, (), (const, override));
 };
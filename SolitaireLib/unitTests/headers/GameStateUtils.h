@@ -0,0 +1,29 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "GameState.h"
+#include "cards/Cards.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+
+namespace solitaire {
+
+using TableauPilesCards = std::array<cards::Cards, interfaces::Solitaire::tableauPilesCount>;
+using TableauPilesTopCoveredCardPositions =
+    std::array<std::uint8_t, interfaces::Solitaire::tableauPilesCount>;
+using FoundationPilesCards =
+    std::array<cards::Cards, interfaces::Solitaire::foundationPilesCount>;
+
+cards::Cards createFoundationPileCards(const cards::Suit suit,
+                                       const cards::Value topCardValue);
+
+GameState createGameState(
+    const TableauPilesCards& tableauPilesCards,
+    const TableauPilesTopCoveredCardPositions& topCoveredCardPositions,
+    const FoundationPilesCards& foundationPilesCards,
+    const cards::Cards& stockPileCards,
+    const std::uint8_t stockPileSelectedCardIndex = GameState::noSelectedStockPileCard);
+
+}
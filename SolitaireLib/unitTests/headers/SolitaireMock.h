@@ -1,7 +1,9 @@
 #pragma once
 
+#include "GameState.h"
 #include "gmock/gmock.h"
 #include "interfaces/Solitaire.h"
+#include "moves/Move.h"
 #include "piles/PileId.h"
 
 namespace solitaire {
@@ -10,7 +12,11 @@ class SolitaireMock: public interfaces::Solitaire {
 public:
     MOCK_METHOD(void, startNewGame, (), (override));
 
+    MOCK_METHOD(GameState, exportGameState, (), (const, override));
+    MOCK_METHOD(void, importGameState, (const GameState&), (override));
+
     MOCK_METHOD(void, tryUndoOperation, (), (override));
+    MOCK_METHOD(void, tryRedoOperation, (), (override));
     MOCK_METHOD(void, tryPutCardsBackFromHand, (), (override));
 
     MOCK_METHOD(void, tryPullOutCardFromFoundationPile, (const piles::PileId), (override));
@@ -21,10 +27,25 @@ public:
                 (const piles::PileId, const unsigned), (override));
     MOCK_METHOD(void, tryAddCardsOnTableauPile, (const piles::PileId), (override));
 
+    MOCK_METHOD(void, tryMoveCardsBetweenTableauPiles,
+                (const piles::PileId, const unsigned, const piles::PileId), (override));
+    MOCK_METHOD(void, tryMoveCardFromTableauPileToFoundationPile,
+                (const piles::PileId, const piles::PileId), (override));
+
     MOCK_METHOD(void, trySelectNextStockPileCard, (), (override));
     MOCK_METHOD(void, tryPullOutCardFromStockPile, (), (override));
 
+    MOCK_METHOD(bool, canAutoComplete, (), (const, override));
+    MOCK_METHOD(std::vector<moves::Move>, getAutoCompleteMoves, (), (const, override));
+    MOCK_METHOD(void, tryAutoComplete, (), (override));
+
+    MOCK_METHOD(void, beginTransaction, (), (override));
+    MOCK_METHOD(bool, tryApplyMove, (const moves::Move&), (override));
+    MOCK_METHOD(void, commitTransaction, (), (override));
+    MOCK_METHOD(void, abortTransaction, (), (override));
+
     MOCK_METHOD(bool, isGameFinished, (), (const, override));
+    MOCK_METHOD(std::uint64_t, getPositionHash, (), (const, override));
 
     MOCK_METHOD(const piles::interfaces::FoundationPile&, getFoundationPile,
                 (const piles::PileId), (const, override));
@@ -32,6 +53,7 @@ public:
                 (const piles::PileId), (const, override));
     MOCK_METHOD(const piles::interfaces::StockPile&, getStockPile, (), (const, override));
     MOCK_METHOD(const cards::Cards&, getCardsInHand, (), (const, override));
+    MOCK_METHOD(cards::CardSet, getCardSetInHand, (), (const, override));
 };
 
 }
@@ -10,6 +10,8 @@ public:
     MOCK_METHOD(void, restore, (), (const, override));
     MOCK_METHOD(bool, isSnapshotOfSameObject,
                 (const interfaces::Snapshot&), (const, override));
+    MOCK_METHOD(const void*, getObjectKey, (), (const, override));
+    MOCK_METHOD(std::size_t, getMemoryUsage, (), (const, override));
 };
 
 }
@@ -8,11 +8,17 @@ namespace solitaire::piles {
 class FoundationPileMock: public interfaces::FoundationPile {
 public:
     MOCK_METHOD(void, initialize, (), (override));
+    MOCK_METHOD(void, initialize, (const cards::Deck::const_iterator&,
+                                   const cards::Deck::const_iterator&), (override));
     MOCK_METHOD(std::unique_ptr<archivers::interfaces::Snapshot>,
                 createSnapshot, (), (override));
     MOCK_METHOD(void, tryAddCard, (std::optional<cards::Card>&), (override));
     MOCK_METHOD(std::optional<cards::Card>, tryPullOutCard, (), (override));
+    MOCK_METHOD(bool, canAddCard, (const cards::Card&), (const, override));
+    MOCK_METHOD(bool, canPullOutCard, (), (const, override));
     MOCK_METHOD(const cards::Cards&, getCards, (), (const, override));
+    MOCK_METHOD(cards::CardSet, getCardSet, (), (const, override));
+    MOCK_METHOD(std::uint64_t, getPositionHash, (), (const, override));
     MOCK_METHOD(std::optional<cards::Value>, getTopCardValue, (), (const, override));
 };
 
@@ -7,11 +7,11 @@
 
 namespace solitaire::piles {
 
-template <class T>
-void initializePile(T& pile, const cards::Cards& cards) {
+template <class T, class... Args>
+void initializePile(T& pile, const cards::Cards& cards, const Args&... args) {
     cards::Deck deck;
     std::copy_n(cards.begin(), cards.size(), deck.begin());
-    pile.initialize(deck.begin(), std::next(deck.begin(), cards.size()));
+    pile.initialize(deck.begin(), std::next(deck.begin(), cards.size()), args...);
 }
 
 }
@@ -9,11 +9,19 @@ class StockPileMock: public interfaces::StockPile {
 public:
     MOCK_METHOD(void, initialize, (const cards::Deck::const_iterator&,
                                    const cards::Deck::const_iterator&), (override));
+    MOCK_METHOD(void, initialize, (const cards::Deck::const_iterator&,
+                                   const cards::Deck::const_iterator&,
+                                   const std::optional<unsigned>), (override));
     MOCK_METHOD(std::unique_ptr<archivers::interfaces::Snapshot>,
                 createSnapshot, (), (override));
     MOCK_METHOD(void, trySelectNextCard, (), (override));
+    MOCK_METHOD(void, trySelectPreviousCard, (), (override));
     MOCK_METHOD(std::optional<cards::Card>, tryPullOutCard, (), (override));
+    MOCK_METHOD(void, putBackCard, (const cards::Card&), (override));
+    MOCK_METHOD(bool, canPullOutCard, (), (const, override));
     MOCK_METHOD(const cards::Cards&, getCards, (), (const, override));
+    MOCK_METHOD(cards::CardSet, getCardSet, (), (const, override));
+    MOCK_METHOD(std::uint64_t, getPositionHash, (), (const, override));
     MOCK_METHOD(std::optional<unsigned>, getSelectedCardIndex, (), (const, override));
 };
 
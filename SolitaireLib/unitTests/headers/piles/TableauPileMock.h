@@ -9,12 +9,28 @@ class TableauPileMock: public interfaces::TableauPile {
 public:
     MOCK_METHOD(void, initialize, (const cards::Deck::const_iterator&,
                                    const cards::Deck::const_iterator&), (override));
+    MOCK_METHOD(void, initialize, (const cards::Deck::const_iterator&,
+                                   const cards::Deck::const_iterator&,
+                                   const unsigned), (override));
     MOCK_METHOD(std::unique_ptr<archivers::interfaces::Snapshot>,
                 createSnapshot, (), (override));
     MOCK_METHOD(void, tryUncoverTopCard, (), (override));
+    MOCK_METHOD(void, tryCoverTopCard, (), (override));
     MOCK_METHOD(void, tryAddCards, (cards::Cards&), (override));
+    MOCK_METHOD(bool, tryAddCards, (cards::Cards::const_iterator,
+                                    cards::Cards::const_iterator), (override));
     MOCK_METHOD(cards::Cards, tryPullOutCards, (unsigned), (override));
+    MOCK_METHOD(bool, tryMoveCards, (unsigned, interfaces::TableauPile&), (override));
+    MOCK_METHOD(bool, tryMoveTopCard, (interfaces::FoundationPile&), (override));
+    MOCK_METHOD(void, putBackCards, (cards::Cards::const_iterator,
+                                     cards::Cards::const_iterator), (override));
+    MOCK_METHOD(bool, canAddCards, (cards::Cards::const_iterator,
+                                    cards::Cards::const_iterator), (const, override));
+    MOCK_METHOD(bool, canPullOutCards, (unsigned), (const, override));
     MOCK_METHOD(const cards::Cards&, getCards, (), (const, override));
+    MOCK_METHOD(cards::CardSet, getCardSet, (), (const, override));
+    MOCK_METHOD(std::uint64_t, getPositionHash, (), (const, override));
+    MOCK_METHOD(cards::CardSet, getCoveredCardSet, (), (const, override));
     MOCK_METHOD(unsigned, getTopCoveredCardPosition, (), (const, override));
     MOCK_METHOD(bool, isTopCardCovered, (), (const, override));
 };
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "gmock/gmock.h"
+#include "interfaces/solvers/HintEngine.h"
+
+namespace solitaire::solvers {
+
+class HintEngineMock: public interfaces::HintEngine {
+public:
+    MOCK_METHOD(void, analyzePosition, (const solitaire::interfaces::Solitaire&), (override));
+    MOCK_METHOD(std::optional<moves::Move>, getHint, (), (const, override));
+};
+
+}
@@ -6,11 +6,13 @@
 #include "events/EventsProcessorMock.h"
 #include "gmock/gmock.h"
 #include "graphics/RendererMock.h"
+#include "solvers/HintEngineMock.h"
 #include "time/FPSLimiterMock.h"
 
 using namespace testing;
 using namespace solitaire::events;
 using namespace solitaire::graphics;
+using namespace solitaire::solvers;
 using namespace solitaire::time;
 
 namespace solitaire {
@@ -20,12 +22,16 @@ public:
     void expectApplicationLoop() {
         EXPECT_CALL(*fpsLimiterMock, saveFrameStartTime());
         EXPECT_CALL(*eventsProcessorMock, processEvents());
+        EXPECT_CALL(*contextMock, getHintEngine()).WillOnce(ReturnRef(hintEngineMock));
+        EXPECT_CALL(*contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
+        EXPECT_CALL(hintEngineMock, analyzePosition(Ref(solitaireMock)));
         EXPECT_CALL(*rendererMock, render());
         EXPECT_CALL(*fpsLimiterMock, sleepRestOfFrameTime());
     }
 
     InSequence seq;
     SolitaireMock solitaireMock;
+    HintEngineMock hintEngineMock;
     mock_ptr<ContextMock> contextMock;
     mock_ptr<EventsProcessorMock> eventsProcessorMock;
     mock_ptr<RendererMock> rendererMock;
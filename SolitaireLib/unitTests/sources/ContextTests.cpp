@@ -9,11 +9,13 @@
 #include "colliders/StockPileColliderMock.h"
 #include "colliders/TableauPileColliderMock.h"
 #include "gtest/gtest.h"
+#include "solvers/HintEngineMock.h"
 
 using namespace testing;
 using namespace solitaire::colliders;
 using namespace solitaire::geometry;
 using namespace solitaire::piles;
+using namespace solitaire::solvers;
 
 namespace solitaire {
 
@@ -50,7 +52,8 @@ public:
         context = std::make_unique<Context>(
             solitaireMock.make_unique(), std::move(foundationPileColliders),
             std::move(tableauPileColliders), stockPileColliderMock.make_unique(),
-            newGameButtonMock.make_unique(), undoButtonMock.make_unique());
+            newGameButtonMock.make_unique(), undoButtonMock.make_unique(),
+            hintEngineMock.make_unique());
     }
 
     mock_ptr<SolitaireMock> solitaireMock;
@@ -59,6 +62,7 @@ public:
     mock_ptr<StockPileColliderMock> stockPileColliderMock;
     mock_ptr<ButtonMock> newGameButtonMock;
     mock_ptr<ButtonMock> undoButtonMock;
+    mock_ptr<HintEngineMock> hintEngineMock;
     std::unique_ptr<Context> context;
 };
 
@@ -124,6 +128,11 @@ TEST_F(ContextTests, getUndoButton) {
     EXPECT_EQ(&std::as_const(*context).getUndoButton(), undoButtonMock.get());
 }
 
+TEST_F(ContextTests, getHintEngine) {
+    EXPECT_EQ(&context->getHintEngine(), hintEngineMock.get());
+    EXPECT_EQ(&std::as_const(*context).getHintEngine(), hintEngineMock.get());
+}
+
 TEST_F(ContextTests, setAndGetPositions) {
     Position position1 {1, 7};
     Position position2 {2, 4};
@@ -0,0 +1,105 @@
+#include <unordered_set>
+
+#include "GameState.h"
+#include "cards/DeckGeneratorUtils.h"
+#include "cards/ZobristKeys.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+
+namespace solitaire {
+
+class GameStateTest: public Test {
+public:
+    GameStateTest() {
+        gameState.cards = createSortedDeck();
+        gameState.tableauPilesSizes = {1, 2, 3, 4, 5, 6, 7};
+        gameState.tableauPilesTopCoveredCardPositions = {0, 1, 2, 3, 4, 5, 6};
+        gameState.foundationPilesSizes = {0, 0, 0, 0};
+        gameState.stockPileSelectedCardIndex = GameState::noSelectedStockPileCard;
+    }
+
+    GameState gameState;
+};
+
+TEST_F(GameStateTest, createGameStateOfNewGameFromDeck) {
+    EXPECT_EQ(GameState::fromDeck(createSortedDeck()), gameState);
+}
+
+TEST_F(GameStateTest, copiedGameStateIsEqual) {
+    const auto copy = gameState;
+
+    EXPECT_TRUE(copy == gameState);
+    EXPECT_FALSE(copy != gameState);
+    EXPECT_EQ(std::hash<GameState> {}(copy), std::hash<GameState> {}(gameState));
+}
+
+TEST_F(GameStateTest, gameStatesDifferingInOneFieldAreNotEqual) {
+    auto otherGameState = gameState;
+    otherGameState.stockPileSelectedCardIndex = 0;
+
+    EXPECT_FALSE(otherGameState == gameState);
+    EXPECT_TRUE(otherGameState != gameState);
+    EXPECT_NE(std::hash<GameState> {}(otherGameState), std::hash<GameState> {}(gameState));
+}
+
+TEST_F(GameStateTest, getPilesOffsets) {
+    gameState.foundationPilesSizes = {0, 2, 0, 1};
+
+    EXPECT_THAT(gameState.getPilesOffsets(), ElementsAre(
+        0, 1, 3, 6, 10, 15, 21, 28, 28, 30, 30, 31, 52));
+}
+
+TEST_F(GameStateTest, getPositionHashOfNewGame) {
+    std::uint64_t expectedHash = 0;
+    for (unsigned id = 0; id < gameState.tableauPilesSizes.size(); ++id) {
+        const auto firstPileCard = std::next(gameState.cards.begin(), id * (id + 1) / 2);
+        const auto topPileCard = std::next(firstPileCard, id);
+        expectedHash ^= placeZobristHashOnPile(
+            getZobristHash(firstPileCard, topPileCard, CardLocation::TableauPileCovered) ^
+            getZobristKey(CardLocation::TableauPileUncovered, *topPileCard), id);
+    }
+    expectedHash ^= placeZobristHashOnPile(
+        getZobristHash(std::next(gameState.cards.begin(), 28), gameState.cards.end(),
+                       CardLocation::StockPileStock),
+        GameState::stockPileIndex);
+
+    EXPECT_EQ(gameState.getPositionHash(), expectedHash);
+}
+
+TEST_F(GameStateTest, positionHashDependsOnTableauPileCardsCovering) {
+    auto otherGameState = gameState;
+    otherGameState.tableauPilesTopCoveredCardPositions[6] = 7;
+    EXPECT_NE(otherGameState.getPositionHash(), gameState.getPositionHash());
+}
+
+TEST_F(GameStateTest, positionHashDependsOnStockPileSelectedCard) {
+    auto otherGameState = gameState;
+    otherGameState.stockPileSelectedCardIndex = 0;
+    EXPECT_NE(otherGameState.getPositionHash(), gameState.getPositionHash());
+}
+
+TEST_F(GameStateTest, positionHashDependsOnPileOfCard) {
+    auto gameStateWithCardOnFirstFoundationPile = gameState;
+    gameStateWithCardOnFirstFoundationPile.tableauPilesSizes[0] = 0;
+    gameStateWithCardOnFirstFoundationPile.foundationPilesSizes[0] = 1;
+    auto gameStateWithCardOnSecondFoundationPile = gameStateWithCardOnFirstFoundationPile;
+    std::swap(gameStateWithCardOnSecondFoundationPile.foundationPilesSizes[0],
+              gameStateWithCardOnSecondFoundationPile.foundationPilesSizes[1]);
+
+    EXPECT_NE(gameStateWithCardOnFirstFoundationPile.getPositionHash(),
+              gameStateWithCardOnSecondFoundationPile.getPositionHash());
+}
+
+TEST_F(GameStateTest, useGameStateAsHashSetKey) {
+    auto otherGameState = gameState;
+    std::swap(otherGameState.cards[0], otherGameState.cards[1]);
+
+    const std::unordered_set<GameState> gameStates {gameState, otherGameState, gameState};
+
+    EXPECT_EQ(gameStates.size(), 2);
+    EXPECT_EQ(gameStates.count(otherGameState), 1);
+}
+
+}
@@ -0,0 +1,56 @@
+#include <algorithm>
+
+#include "GameStateUtils.h"
+#include "cards/CardSet.h"
+#include "cards/DeckGeneratorUtils.h"
+
+using namespace solitaire::cards;
+
+namespace solitaire {
+
+Cards createFoundationPileCards(const Suit suit, const Value topCardValue) {
+    Cards cards;
+    for (const auto& card: createSortedDeck())
+        if (card.getSuit() == suit and to_int(card.getValue()) <= to_int(topCardValue))
+            cards.push_back(card);
+    return cards;
+}
+
+GameState createGameState(
+    const TableauPilesCards& tableauPilesCards,
+    const TableauPilesTopCoveredCardPositions& topCoveredCardPositions,
+    const FoundationPilesCards& foundationPilesCards,
+    const Cards& stockPileCards,
+    const std::uint8_t stockPileSelectedCardIndex)
+{
+    GameState gameState;
+    auto nextCard = gameState.cards.begin();
+    CardSet usedCards;
+
+    for (unsigned id = 0; id < tableauPilesCards.size(); ++id) {
+        const auto& pileCards = tableauPilesCards[id];
+        nextCard = std::copy(pileCards.begin(), pileCards.end(), nextCard);
+        usedCards.insert(pileCards.begin(), pileCards.end());
+        gameState.tableauPilesSizes[id] = pileCards.size();
+    }
+
+    for (unsigned id = 0; id < foundationPilesCards.size(); ++id) {
+        const auto& pileCards = foundationPilesCards[id];
+        nextCard = std::copy(pileCards.begin(), pileCards.end(), nextCard);
+        usedCards.insert(pileCards.begin(), pileCards.end());
+        gameState.foundationPilesSizes[id] = pileCards.size();
+    }
+
+    nextCard = std::copy(stockPileCards.begin(), stockPileCards.end(), nextCard);
+    usedCards.insert(stockPileCards.begin(), stockPileCards.end());
+
+    for (const auto& card: createSortedDeck())
+        if (not usedCards.contains(card))
+            *nextCard++ = card;
+
+    gameState.tableauPilesTopCoveredCardPositions = topCoveredCardPositions;
+    gameState.stockPileSelectedCardIndex = stockPileSelectedCardIndex;
+    return gameState;
+}
+
+}
@@ -1,22 +1,33 @@
 #include <algorithm>
+#include <numeric>
 
 #include "mock_ptr.h"
+#include "GameState.h"
+#include "GameStateUtils.h"
 #include "Solitaire.h"
 #include "archivers/HistoryTrackerMock.h"
+#include "archivers/MoveCardsOperationSnapshotCreator.h"
 #include "archivers/MoveCardsOperationSnapshotCreatorMock.h"
 #include "archivers/SnapshotMock.h"
 #include "cards/DeckGeneratorMock.h"
 #include "cards/DeckGeneratorUtils.h"
+#include "cards/Suit.h"
 #include "cards/Value.h"
 #include "gmock/gmock.h"
+#include "moves/Move.h"
+#include "moves/ReversibleMoves.h"
+#include "piles/FoundationPile.h"
 #include "piles/FoundationPileMock.h"
 #include "piles/PileId.h"
+#include "piles/StockPile.h"
 #include "piles/StockPileMock.h"
+#include "piles/TableauPile.h"
 #include "piles/TableauPileMock.h"
 
 using namespace testing;
 using namespace solitaire::archivers;
 using namespace solitaire::cards;
+using namespace solitaire::moves;
 using namespace solitaire::piles;
 using namespace solitaire::piles::interfaces;
 
@@ -29,6 +40,7 @@ constexpr unsigned tableauPilesCount {7};
 const PileId invalidFoundationPileId {foundationPilesCount};
 const PileId lastFoundationPileId {foundationPilesCount - 1};
 const PileId invalidTableauPileId {tableauPilesCount};
+const PileId firstTableauPileId {0};
 const PileId lastTableauPileId {tableauPilesCount - 1};
 
 constexpr unsigned quantityToPullOut {2};
@@ -41,6 +53,15 @@ const Cards twoCards {deck[0], deck[1]};
 MATCHER_P2(RangeEq, begin, end, "") {
     return std::equal(std::get<0>(arg), std::get<1>(arg), begin, end);
 }
+
+Cards createSuitCards(const Suit suit,
+                      const cards::Value topCardValue = cards::Value::King)
+{
+    Cards cards;
+    for (auto value = to_int(cards::Value::Ace); value <= to_int(topCardValue); ++value)
+        cards.push_back(Card {static_cast<cards::Value>(value), suit});
+    return cards;
+}
 }
 
 class SolitaireTest: public Test {
@@ -88,8 +109,8 @@ public:
     Solitaire solitaire {
         deckGeneratorMock.make_unique(),
         stockPileMock,
-        copySharedPtrArray<FoundationPile>(foundationPileMocks),
-        copySharedPtrArray<TableauPile>(tableauPileMocks),
+        copySharedPtrArray<piles::interfaces::FoundationPile>(foundationPileMocks),
+        copySharedPtrArray<piles::interfaces::TableauPile>(tableauPileMocks),
         historyTrackerMock.make_unique(),
         moveCardsOperationSnapshotCreatorMock.make_unique()
     };
@@ -97,6 +118,7 @@ public:
 
 TEST_F(SolitaireTest, afterInitializationHandIsEmpty) {
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireTest, tryPullOutCardFromFoundationPileWithIdGreaterThanThree) {
@@ -148,6 +170,32 @@ TEST_F(SolitaireTest, tryAddCardsOnTableauPileWithIdGreaterThanSix) {
     );
 }
 
+TEST_F(SolitaireTest, tryMoveCardsBetweenTableauPilesWithIdGreaterThanSix) {
+    EXPECT_THROW(
+        solitaire.tryMoveCardsBetweenTableauPiles(
+            invalidTableauPileId, quantityToPullOut, lastTableauPileId),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        solitaire.tryMoveCardsBetweenTableauPiles(
+            lastTableauPileId, quantityToPullOut, invalidTableauPileId),
+        std::runtime_error
+    );
+}
+
+TEST_F(SolitaireTest, tryMoveCardFromTableauPileToFoundationPileWithInvalidId) {
+    EXPECT_THROW(
+        solitaire.tryMoveCardFromTableauPileToFoundationPile(
+            invalidTableauPileId, lastFoundationPileId),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        solitaire.tryMoveCardFromTableauPileToFoundationPile(
+            lastTableauPileId, invalidFoundationPileId),
+        std::runtime_error
+    );
+}
+
 TEST_F(SolitaireTest, getTableauPileWithIdGreaterThanSix) {
     EXPECT_THROW(solitaire.getTableauPile(invalidTableauPileId), std::runtime_error);
 }
@@ -164,13 +212,6 @@ class SolitaireEmptyHandTest: public SolitaireTest {
 public:
     using StrictSnapshotMockPtr = mock_ptr<StrictMock<SnapshotMock>>;
 
-    SolitaireEmptyHandTest() {
-        EXPECT_CALL(*foundationPileMocks[0], getTopCardValue()).WillRepeatedly(Return(Value::King));
-        EXPECT_CALL(*foundationPileMocks[1], getTopCardValue()).WillRepeatedly(Return(Value::King));
-        EXPECT_CALL(*foundationPileMocks[2], getTopCardValue()).WillRepeatedly(Return(Value::King));
-        EXPECT_CALL(*foundationPileMocks[3], getTopCardValue()).WillRepeatedly(Return(Value::Queen));
-    }
-
     void ignoreEmptyHandPossibleOperationsTest() {
         EXPECT_CALL(*historyTrackerMock, getHistorySize()).Times(0);
         EXPECT_CALL(*historyTrackerMock, undo()).Times(0);
@@ -178,7 +219,9 @@ public:
         EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).Times(0);
         EXPECT_CALL(lastTableauPileMock, tryUncoverTopCard()).Times(0);
         EXPECT_CALL(lastTableauPileMock, tryPullOutCards(_)).Times(0);
-        EXPECT_CALL(*stockPileMock, getCards()).Times(0);
+        EXPECT_CALL(lastTableauPileMock, tryMoveCards(_, _)).Times(0);
+        EXPECT_CALL(lastTableauPileMock, tryMoveTopCard(_)).Times(0);
+        EXPECT_CALL(*stockPileMock, getCardSet()).Times(0);
         EXPECT_CALL(*stockPileMock, trySelectNextCard()).Times(0);
         EXPECT_CALL(*stockPileMock, tryPullOutCard()).Times(0);
 
@@ -186,13 +229,36 @@ public:
         solitaire.tryPullOutCardFromFoundationPile(lastFoundationPileId);
         solitaire.tryUncoverTableauPileTopCard(lastTableauPileId);
         solitaire.tryPullOutCardsFromTableauPile(lastTableauPileId, quantityToPullOut);
+        solitaire.tryMoveCardsBetweenTableauPiles(
+            lastTableauPileId, quantityToPullOut, firstTableauPileId);
+        solitaire.tryMoveCardFromTableauPileToFoundationPile(
+            lastTableauPileId, lastFoundationPileId);
         solitaire.trySelectNextStockPileCard();
         solitaire.tryPullOutCardFromStockPile();
     }
 
+    void importGameStateWithFoundationPilesSizes(
+        const std::array<std::uint8_t, foundationPilesCount>& foundationPilesSizes)
+    {
+        GameState gameState {};
+        gameState.cards = deck;
+        gameState.foundationPilesSizes = foundationPilesSizes;
+        gameState.stockPileSelectedCardIndex = GameState::noSelectedStockPileCard;
+
+        EXPECT_CALL(*historyTrackerMock, reset());
+        solitaire.importGameState(gameState);
+    }
+
     void finishGame() {
-        for (auto& pile: foundationPileMocks)
-            EXPECT_CALL(*pile, getTopCardValue()).WillRepeatedly(Return(Value::King));
+        importGameStateWithFoundationPilesSizes({13, 13, 13, 13});
+    }
+
+    void expectFoundationPilesCardsCounting(
+        const std::array<Cards, foundationPilesCount>& foundationPilesCards)
+    {
+        for (unsigned id = 0; id < foundationPilesCount; ++id)
+            EXPECT_CALL(*foundationPileMocks[id], getCards())
+                .WillOnce(ReturnRef(foundationPilesCards[id]));
     }
 
     template <class Pile>
@@ -230,7 +296,38 @@ public:
         );
     }
 
+    void expectCheckingMoveBetweenTableauPiles(
+        TableauPileMock& destinationPileMock, const bool canAddCards)
+    {
+        EXPECT_CALL(lastTableauPileMock, canPullOutCards(quantityToPullOut))
+            .WillOnce(Return(true));
+        EXPECT_CALL(lastTableauPileMock, getCards()).WillOnce(ReturnRef(twoCards));
+        EXPECT_CALL(destinationPileMock, canAddCards(_, _))
+            .With(AllArgs(RangeEq(twoCards.begin(), twoCards.end())))
+            .WillOnce(Return(canAddCards));
+    }
+
+    void expectCheckingMoveFromTableauPileToFoundationPile(const bool canAddCard) {
+        EXPECT_CALL(lastTableauPileMock, canPullOutCards(1)).WillOnce(Return(true));
+        EXPECT_CALL(lastTableauPileMock, getCards()).WillOnce(ReturnRef(oneCard));
+        EXPECT_CALL(lastFoundationPileMock, canAddCard(oneCard.back()))
+            .WillOnce(Return(canAddCard));
+    }
+
+    void expectMovingCardFromTableauPileToFoundationPile() {
+        expectCheckingMoveFromTableauPileToFoundationPile(true);
+        EXPECT_CALL(lastTableauPileMock, createSnapshot());
+        EXPECT_CALL(lastFoundationPileMock, createSnapshot());
+        EXPECT_CALL(lastTableauPileMock, tryMoveTopCard(Ref(lastFoundationPileMock)))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, saveSourcePileSnapshot(_));
+        EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock,
+                    createSnapshotIfCardsMovedToOtherPile(_));
+    }
+
     StrictSnapshotMockPtr snapshotMock;
+    StrictSnapshotMockPtr destinationSnapshotMock;
+    StrictSnapshotMockPtr moveOperationSnapshotMock;
 };
 
 TEST_F(SolitaireEmptyHandTest, dontUndoOperationWhenHistoryIsEmpty) {
@@ -239,9 +336,18 @@ TEST_F(SolitaireEmptyHandTest, dontUndoOperationWhenHistoryIsEmpty) {
     solitaire.tryUndoOperation();
 }
 
+TEST_F(SolitaireEmptyHandTest, dontRedoOperationWithoutMoveRecordsHistory) {
+    EXPECT_CALL(*historyTrackerMock, undo()).Times(0);
+    solitaire.tryRedoOperation();
+}
+
 TEST_F(SolitaireEmptyHandTest, undoOperationWhenHistoryIsNotEmpty) {
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {};
+
+    InSequence seq;
     EXPECT_CALL(*historyTrackerMock, getHistorySize()).WillOnce(Return(1));
     EXPECT_CALL(*historyTrackerMock, undo());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
     solitaire.tryUndoOperation();
 }
 
@@ -249,19 +355,22 @@ TEST_F(SolitaireEmptyHandTest, ignoreTryOfPuttingCardBack) {
     EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, restoreSourcePile()).Times(0);
     solitaire.tryPutCardsBackFromHand();
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutNoCardsFromFoundationPile) {
-    EXPECT_CALL(lastFoundationPileMock, createSnapshot());
-    EXPECT_CALL(lastFoundationPileMock, tryPullOutCard())
-        .WillOnce(Return(std::nullopt));
+    EXPECT_CALL(lastFoundationPileMock, canPullOutCard()).WillOnce(Return(false));
+    EXPECT_CALL(lastFoundationPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastFoundationPileMock, tryPullOutCard()).Times(0);
 
     solitaire.tryPullOutCardFromFoundationPile(lastFoundationPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutCardFromFoundationPile) {
     InSequence seq;
+    EXPECT_CALL(lastFoundationPileMock, canPullOutCard()).WillOnce(Return(true));
     expectSnapshotCreation(lastFoundationPileMock, snapshotMock);
     EXPECT_CALL(lastFoundationPileMock, tryPullOutCard())
         .WillOnce(Return(oneCard.back()));
@@ -269,6 +378,7 @@ TEST_F(SolitaireEmptyHandTest, tryPullOutCardFromFoundationPile) {
 
     solitaire.tryPullOutCardFromFoundationPile(lastFoundationPileId);
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(oneCard));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {oneCard.begin(), oneCard.end()}));
 }
 
 TEST_F(SolitaireEmptyHandTest, tryAddCardOnFoundationPile) {
@@ -277,6 +387,7 @@ TEST_F(SolitaireEmptyHandTest, tryAddCardOnFoundationPile) {
 
     solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, dontUncoverTableauPileTopCardWhenTopCardUncovered) {
@@ -298,16 +409,20 @@ TEST_F(SolitaireEmptyHandTest, tryUncoverTableauPileTopCard) {
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutNoCardsFromTableauPile) {
-    EXPECT_CALL(lastTableauPileMock, createSnapshot());
-    EXPECT_CALL(lastTableauPileMock, tryPullOutCards(quantityToPullOut))
-        .WillOnce(Return(noCards));
+    EXPECT_CALL(lastTableauPileMock, canPullOutCards(quantityToPullOut))
+        .WillOnce(Return(false));
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryPullOutCards(_)).Times(0);
 
     solitaire.tryPullOutCardsFromTableauPile(lastTableauPileId, quantityToPullOut);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutCardsFromTableauPile) {
     InSequence seq;
+    EXPECT_CALL(lastTableauPileMock, canPullOutCards(quantityToPullOut))
+        .WillOnce(Return(true));
     expectSnapshotCreation(lastTableauPileMock, snapshotMock);
     EXPECT_CALL(lastTableauPileMock, tryPullOutCards(quantityToPullOut))
         .WillOnce(Return(twoCards));
@@ -315,6 +430,7 @@ TEST_F(SolitaireEmptyHandTest, tryPullOutCardsFromTableauPile) {
 
     solitaire.tryPullOutCardsFromTableauPile(lastTableauPileId, quantityToPullOut);
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(twoCards));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {twoCards.begin(), twoCards.end()}));
 }
 
 TEST_F(SolitaireEmptyHandTest, tryAddCardsOnTableauPile) {
@@ -323,10 +439,11 @@ TEST_F(SolitaireEmptyHandTest, tryAddCardsOnTableauPile) {
 
     solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, dontSelectNextStockPileCardWhenNoCards) {
-    EXPECT_CALL(*stockPileMock, getCards()).WillOnce(ReturnRef(noCards));
+    EXPECT_CALL(*stockPileMock, getCardSet()).WillOnce(Return(CardSet {}));
     EXPECT_CALL(*stockPileMock, createSnapshot()).Times(0);
     EXPECT_CALL(*stockPileMock, trySelectNextCard()).Times(0);
     solitaire.trySelectNextStockPileCard();
@@ -334,7 +451,8 @@ TEST_F(SolitaireEmptyHandTest, dontSelectNextStockPileCardWhenNoCards) {
 
 TEST_F(SolitaireEmptyHandTest, trySelectNextStockPileCard) {
     InSequence seq;
-    EXPECT_CALL(*stockPileMock, getCards()).WillOnce(ReturnRef(oneCard));
+    EXPECT_CALL(*stockPileMock, getCardSet())
+        .WillOnce(Return(CardSet {oneCard.begin(), oneCard.end()}));
     expectSnapshotCreation(*stockPileMock, snapshotMock);
     EXPECT_CALL(*stockPileMock, trySelectNextCard());
     EXPECT_CALL(*historyTrackerMock, save(Pointer(snapshotMock.get())));
@@ -343,37 +461,135 @@ TEST_F(SolitaireEmptyHandTest, trySelectNextStockPileCard) {
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutNoCardsFromStockPile) {
-    EXPECT_CALL(*stockPileMock, createSnapshot());
-    EXPECT_CALL(*stockPileMock, tryPullOutCard()).WillOnce(Return(std::nullopt));
+    EXPECT_CALL(*stockPileMock, canPullOutCard()).WillOnce(Return(false));
+    EXPECT_CALL(*stockPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(*stockPileMock, tryPullOutCard()).Times(0);
 
     solitaire.tryPullOutCardFromStockPile();
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireEmptyHandTest, tryPullOutCardFromStockPile) {
     InSequence seq;
+    EXPECT_CALL(*stockPileMock, canPullOutCard()).WillOnce(Return(true));
     expectSnapshotCreation(*stockPileMock, snapshotMock);
     EXPECT_CALL(*stockPileMock, tryPullOutCard()).WillOnce(Return(oneCard.back()));
     expectSavingSourcePileSnapshot(snapshotMock);
 
     solitaire.tryPullOutCardFromStockPile();
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(oneCard));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {oneCard.begin(), oneCard.end()}));
 }
 
-TEST_F(SolitaireEmptyHandTest, gameIsNotFinishedWhenAnyOfFoundationPilesDoesNotHaveKingOnTop)
-{
-    EXPECT_CALL(*foundationPileMocks[0], getTopCardValue()).WillOnce(Return(Value::King));
-    EXPECT_CALL(*foundationPileMocks[1], getTopCardValue()).WillOnce(Return(Value::King));
-    EXPECT_CALL(*foundationPileMocks[2], getTopCardValue()).WillOnce(Return(Value::King));
-    EXPECT_CALL(*foundationPileMocks[3], getTopCardValue()).WillOnce(Return(Value::Queen));
+TEST_F(SolitaireEmptyHandTest, tryMoveCardsBetweenTableauPilesWithFail) {
+    auto& destinationPileMock = *tableauPileMocks[firstTableauPileId];
+
+    expectCheckingMoveBetweenTableauPiles(destinationPileMock, false);
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(destinationPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(_, _)).Times(0);
+
+    solitaire.tryMoveCardsBetweenTableauPiles(
+        lastTableauPileId, quantityToPullOut, firstTableauPileId);
+    EXPECT_TRUE(solitaire.getCardsInHand().empty());
+}
+
+TEST_F(SolitaireEmptyHandTest, dontMoveCardsOnSameTableauPile) {
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(_, _)).Times(0);
+
+    solitaire.tryMoveCardsBetweenTableauPiles(
+        lastTableauPileId, quantityToPullOut, lastTableauPileId);
+}
+
+TEST_F(SolitaireEmptyHandTest, moveCardsBetweenTableauPiles) {
+    auto& destinationPileMock = *tableauPileMocks[firstTableauPileId];
+
+    InSequence seq;
+    expectCheckingMoveBetweenTableauPiles(destinationPileMock, true);
+    expectSnapshotCreation(lastTableauPileMock, snapshotMock);
+    expectSnapshotCreation(destinationPileMock, destinationSnapshotMock);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(quantityToPullOut, Ref(destinationPileMock)))
+        .WillOnce(Return(true));
+    expectSavingSourcePileSnapshot(snapshotMock);
+    expectMoveOperationSnapshotCreation(destinationSnapshotMock)
+        .WillOnce(Return(ByMove(moveOperationSnapshotMock.make_unique())));
+    EXPECT_CALL(*historyTrackerMock, save(Pointer(moveOperationSnapshotMock.get())));
+
+    solitaire.tryMoveCardsBetweenTableauPiles(
+        lastTableauPileId, quantityToPullOut, firstTableauPileId);
+    EXPECT_TRUE(solitaire.getCardsInHand().empty());
+}
 
+TEST_F(SolitaireEmptyHandTest, tryMoveCardFromTableauPileToFoundationPileWithFail) {
+    expectCheckingMoveFromTableauPileToFoundationPile(false);
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastFoundationPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryMoveTopCard(_)).Times(0);
+
+    solitaire.tryMoveCardFromTableauPileToFoundationPile(
+        lastTableauPileId, lastFoundationPileId);
+}
+
+TEST_F(SolitaireEmptyHandTest, moveCardFromTableauPileToFoundationPile) {
+    InSequence seq;
+    expectCheckingMoveFromTableauPileToFoundationPile(true);
+    expectSnapshotCreation(lastTableauPileMock, snapshotMock);
+    expectSnapshotCreation(lastFoundationPileMock, destinationSnapshotMock);
+    EXPECT_CALL(lastTableauPileMock, tryMoveTopCard(Ref(lastFoundationPileMock)))
+        .WillOnce(Return(true));
+    expectSavingSourcePileSnapshot(snapshotMock);
+    expectMoveOperationSnapshotCreation(destinationSnapshotMock)
+        .WillOnce(Return(ByMove(moveOperationSnapshotMock.make_unique())));
+    EXPECT_CALL(*historyTrackerMock, save(Pointer(moveOperationSnapshotMock.get())));
+
+    solitaire.tryMoveCardFromTableauPileToFoundationPile(
+        lastTableauPileId, lastFoundationPileId);
+}
+
+TEST_F(SolitaireEmptyHandTest, gameIsNotFinishedWhenAnyCardIsNotOnFoundationPiles) {
+    EXPECT_FALSE(solitaire.isGameFinished());
+    importGameStateWithFoundationPilesSizes({13, 13, 13, 12});
     EXPECT_FALSE(solitaire.isGameFinished());
 }
 
-TEST_F(SolitaireEmptyHandTest, gameIsFinishedWhenAllOfFoundationPilesHaveKingOnTop) {
+TEST_F(SolitaireEmptyHandTest, gameIsFinishedWhenAllCardsAreOnFoundationPiles) {
     for (auto& pile: foundationPileMocks)
-        EXPECT_CALL(*pile, getTopCardValue()).WillOnce(Return(Value::King));
+        EXPECT_CALL(*pile, getTopCardValue()).Times(0);
+
+    finishGame();
+    EXPECT_TRUE(solitaire.isGameFinished());
+}
+
+TEST_F(SolitaireEmptyHandTest, finishGameByMovingLastCardFromTableauPileToFoundationPile) {
+    importGameStateWithFoundationPilesSizes({13, 13, 13, 12});
+    expectMovingCardFromTableauPileToFoundationPile();
+
+    solitaire.tryMoveCardFromTableauPileToFoundationPile(
+        lastTableauPileId, lastFoundationPileId);
+    EXPECT_TRUE(solitaire.isGameFinished());
+}
 
+TEST_F(SolitaireEmptyHandTest, countFoundationPilesCardsAfterUndo) {
+    const auto deckBegin = deck.begin();
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {
+        Cards {deckBegin, std::next(deckBegin, 13)},
+        Cards {std::next(deckBegin, 13), std::next(deckBegin, 26)},
+        Cards {std::next(deckBegin, 26), std::next(deckBegin, 39)},
+        Cards {std::next(deckBegin, 39), std::next(deckBegin, 51)}
+    };
+
+    importGameStateWithFoundationPilesSizes({13, 13, 13, 0});
+    EXPECT_CALL(*historyTrackerMock, getHistorySize()).WillOnce(Return(1));
+    EXPECT_CALL(*historyTrackerMock, undo());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
+    solitaire.tryUndoOperation();
+    EXPECT_FALSE(solitaire.isGameFinished());
+
+    expectMovingCardFromTableauPileToFoundationPile();
+    solitaire.tryMoveCardFromTableauPileToFoundationPile(
+        lastTableauPileId, lastFoundationPileId);
     EXPECT_TRUE(solitaire.isGameFinished());
 }
 
@@ -382,9 +598,549 @@ TEST_F(SolitaireEmptyHandTest, ignoreSomeOperationsIfGameFinished) {
     ignoreEmptyHandPossibleOperationsTest();
 }
 
+class SolitaireAutoCompleteTest: public SolitaireEmptyHandTest {
+public:
+    SolitaireAutoCompleteTest() {
+        for (auto& pile: tableauPileMocks)
+            EXPECT_CALL(*pile, getTopCoveredCardPosition()).WillRepeatedly(Return(0));
+    }
+};
+
+TEST_F(SolitaireAutoCompleteTest, cannotAutoCompleteWhenAnyTableauPileHasCoveredCards) {
+    EXPECT_CALL(lastTableauPileMock, getTopCoveredCardPosition()).WillRepeatedly(Return(1));
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+
+    EXPECT_FALSE(solitaire.canAutoComplete());
+    solitaire.tryAutoComplete();
+}
+
+TEST_F(SolitaireAutoCompleteTest, cannotAutoCompleteFinishedGame) {
+    finishGame();
+    EXPECT_FALSE(solitaire.canAutoComplete());
+}
+
+class SolitaireAutoCompleteWithPilesTest: public Test {
+public:
+    template <class Pile, class Piles>
+    static Piles makePiles() {
+        Piles piles;
+        for (auto& pile: piles)
+            pile = std::make_shared<Pile>();
+        return piles;
+    }
+
+    static GameState createAlmostFinishedGameState() {
+        return createGameState(
+            {
+                Cards {Card {cards::Value::King, Suit::Club},
+                       Card {cards::Value::Queen, Suit::Diamond}},
+                Cards {Card {cards::Value::King, Suit::Diamond},
+                       Card {cards::Value::Queen, Suit::Club}},
+                Cards {Card {cards::Value::Jack, Suit::Diamond}},
+                noCards, noCards, noCards, noCards
+            },
+            {0, 0, 0, 0, 0, 0, 0},
+            {
+                createSuitCards(Suit::Heart),
+                createSuitCards(Suit::Spade),
+                createSuitCards(Suit::Club, cards::Value::Ten),
+                createSuitCards(Suit::Diamond, cards::Value::Nine)
+            },
+            Cards {Card {cards::Value::Ten, Suit::Diamond},
+                   Card {cards::Value::Jack, Suit::Club}}
+        );
+    }
+
+    static GameState createBlockedGameState() {
+        const auto hearts = createSuitCards(Suit::Heart);
+        return createGameState(
+            {
+                Cards {hearts[0], hearts[1]},
+                Cards {std::next(hearts.begin(), 2), hearts.end()},
+                noCards, noCards, noCards, noCards, noCards
+            },
+            {0, 0, 0, 0, 0, 0, 0},
+            {
+                noCards,
+                createSuitCards(Suit::Spade),
+                createSuitCards(Suit::Club),
+                createSuitCards(Suit::Diamond)
+            },
+            noCards
+        );
+    }
+
+    static bool isFinished(const GameState& gameState) {
+        const auto& sizes = gameState.foundationPilesSizes;
+        return std::accumulate(sizes.begin(), sizes.end(), 0u) == gameState.cards.size();
+    }
+
+    mock_ptr<NiceMock<HistoryTrackerMock>> historyTrackerMock;
+
+    Solitaire solitaire {
+        std::make_unique<DeckGeneratorMock>(),
+        std::make_shared<piles::StockPile>(),
+        makePiles<piles::FoundationPile, Solitaire::FoundationPiles>(),
+        makePiles<piles::TableauPile, Solitaire::TableauPiles>(),
+        historyTrackerMock.make_unique(),
+        std::make_unique<archivers::MoveCardsOperationSnapshotCreator>()
+    };
+};
+
+TEST_F(SolitaireAutoCompleteWithPilesTest, autoCompleteMovesFinishGameThroughStockPile) {
+    solitaire.importGameState(createAlmostFinishedGameState());
+    ASSERT_TRUE(solitaire.canAutoComplete());
+
+    const auto autoCompleteMoves = solitaire.getAutoCompleteMoves();
+    EXPECT_THAT(autoCompleteMoves, Contains(Property(
+        &Move::getType, MoveType::SelectNextStockPileCard)));
+
+    auto gameState = solitaire.exportGameState();
+    for (const auto& move: autoCompleteMoves)
+        applyMove(gameState, move);
+    EXPECT_TRUE(isFinished(gameState));
+}
+
+TEST_F(SolitaireAutoCompleteWithPilesTest, autoCompleteFinishesGameAndResetsHistory) {
+    solitaire.importGameState(createAlmostFinishedGameState());
+    EXPECT_CALL(*historyTrackerMock, save(_)).Times(0);
+    EXPECT_CALL(*historyTrackerMock, reset());
+
+    solitaire.tryAutoComplete();
+    EXPECT_TRUE(solitaire.isGameFinished());
+    EXPECT_FALSE(solitaire.canAutoComplete());
+}
+
+TEST_F(SolitaireAutoCompleteWithPilesTest, noAutoCompleteMovesWhenFoundationPileCardIsBlocked) {
+    const auto gameState = createBlockedGameState();
+    solitaire.importGameState(gameState);
+    ASSERT_TRUE(solitaire.canAutoComplete());
+    EXPECT_TRUE(solitaire.getAutoCompleteMoves().empty());
+
+    EXPECT_CALL(*historyTrackerMock, save(_)).Times(0);
+    EXPECT_CALL(*historyTrackerMock, reset()).Times(0);
+    solitaire.tryAutoComplete();
+    EXPECT_EQ(solitaire.exportGameState(), gameState);
+}
+
+class SolitaireTransactionTest: public SolitaireEmptyHandTest {
+public:
+    SolitaireTransactionTest() {
+        solitaire.beginTransaction();
+    }
+
+    template <class Pile>
+    void expectNiceSnapshotCreation(Pile& pile) {
+        EXPECT_CALL(pile, createSnapshot())
+            .WillOnce(Return(ByMove(std::make_unique<NiceMock<SnapshotMock>>())));
+    }
+
+    const Move moveLastToFirstTableauPile {
+        MoveType::MoveTableauPileCardsToTableauPile, lastTableauPileId, firstTableauPileId, 2};
+    const Move moveFirstToLastTableauPile {
+        MoveType::MoveTableauPileCardsToTableauPile, firstTableauPileId, lastTableauPileId};
+    const Move uncoverLastTableauPileTopCard {
+        MoveType::UncoverTableauPileTopCard, lastTableauPileId};
+    const Move moveStockPileCardToLastFoundationPile {
+        MoveType::MoveStockPileCardToFoundationPile, 0, lastFoundationPileId};
+    const Move moveLastFoundationPileCardToFirstTableauPile {
+        MoveType::MoveFoundationPileCardToTableauPile, lastFoundationPileId, firstTableauPileId};
+};
+
+TEST_F(SolitaireTransactionTest, throwExceptionOnBeginningTransactionTwice) {
+    EXPECT_THROW(solitaire.beginTransaction(), std::runtime_error);
+}
+
+TEST_F(SolitaireTransactionTest, throwExceptionOnUsingTransactionWhichIsNotInProgress) {
+    solitaire.commitTransaction();
+
+    EXPECT_THROW(solitaire.tryApplyMove(uncoverLastTableauPileTopCard), std::runtime_error);
+    EXPECT_THROW(solitaire.commitTransaction(), std::runtime_error);
+    EXPECT_THROW(solitaire.abortTransaction(), std::runtime_error);
+}
+
+TEST_F(SolitaireTransactionTest, throwExceptionOnStartingNewGameOrImportingGameState) {
+    GameState gameState {};
+    gameState.cards = deck;
+    gameState.stockPileSelectedCardIndex = GameState::noSelectedStockPileCard;
+
+    EXPECT_THROW(solitaire.startNewGame(), std::runtime_error);
+    EXPECT_THROW(solitaire.importGameState(gameState), std::runtime_error);
+}
+
+TEST_F(SolitaireTransactionTest, ignoreSomeOperationsWhileTransactionIsInProgress) {
+    EXPECT_CALL(lastTableauPileMock, getTopCoveredCardPosition()).Times(0);
+    EXPECT_CALL(lastFoundationPileMock, tryAddCard(_)).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryAddCards(_)).Times(0);
+
+    ignoreEmptyHandPossibleOperationsTest();
+    solitaire.tryRedoOperation();
+    solitaire.tryPutCardsBackFromHand();
+    solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
+    solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
+    EXPECT_FALSE(solitaire.canAutoComplete());
+    solitaire.tryAutoComplete();
+}
+
+TEST_F(SolitaireTransactionTest, endTransactionWhenSavingHistoryOnCommitThrows) {
+    InSequence seq;
+    EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).WillOnce(Return(true));
+    expectNiceSnapshotCreation(lastTableauPileMock);
+    EXPECT_CALL(lastTableauPileMock, tryUncoverTopCard());
+    EXPECT_TRUE(solitaire.tryApplyMove(uncoverLastTableauPileTopCard));
+
+    EXPECT_CALL(*historyTrackerMock, save(NotNull()))
+        .WillOnce(Throw(std::runtime_error {"save"}));
+    EXPECT_THROW(solitaire.commitTransaction(), std::runtime_error);
+    EXPECT_NO_THROW(solitaire.beginTransaction());
+}
+
+TEST_F(SolitaireTransactionTest, endTransactionWhenRestoringSnapshotOnAbortThrows) {
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {};
+
+    InSequence seq;
+    EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).WillOnce(Return(true));
+    expectSnapshotCreation(lastTableauPileMock, snapshotMock);
+    EXPECT_CALL(lastTableauPileMock, tryUncoverTopCard());
+    EXPECT_TRUE(solitaire.tryApplyMove(uncoverLastTableauPileTopCard));
+
+    EXPECT_CALL(*snapshotMock, restore()).WillOnce(Throw(std::runtime_error {"restore"}));
+    expectFoundationPilesCardsCounting(foundationPilesCards);
+    EXPECT_THROW(solitaire.abortTransaction(), std::runtime_error);
+    EXPECT_NO_THROW(solitaire.beginTransaction());
+}
+
+TEST_F(SolitaireEmptyHandTest,
+       abortTransactionOfStockPileCardsSelectionsAndKeepHistoryFromBeforeIt)
+{
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {};
+    const Move selectNextStockPileCard {MoveType::SelectNextStockPileCard};
+
+    EXPECT_CALL(*stockPileMock, getCardSet())
+        .Times(3)
+        .WillRepeatedly(Return(CardSet {oneCard.begin(), oneCard.end()}));
+    EXPECT_CALL(*stockPileMock, createSnapshot())
+        .WillOnce(Return(ByMove(snapshotMock.make_unique())))
+        .WillOnce(Return(ByMove(destinationSnapshotMock.make_unique())));
+    EXPECT_CALL(*stockPileMock, trySelectNextCard()).Times(3);
+    EXPECT_CALL(*historyTrackerMock, save(Pointer(snapshotMock.get())));
+
+    solitaire.trySelectNextStockPileCard();
+    solitaire.beginTransaction();
+    EXPECT_TRUE(solitaire.tryApplyMove(selectNextStockPileCard));
+    EXPECT_TRUE(solitaire.tryApplyMove(selectNextStockPileCard));
+    solitaire.tryUndoOperation();
+
+    InSequence seq;
+    EXPECT_CALL(*destinationSnapshotMock, restore());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
+    solitaire.abortTransaction();
+
+    EXPECT_CALL(*historyTrackerMock, getHistorySize()).WillOnce(Return(1));
+    EXPECT_CALL(*historyTrackerMock, undo());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
+    solitaire.tryUndoOperation();
+}
+
+TEST_F(SolitaireTransactionTest, throwExceptionOnApplyingMoveWithInvalidPileId) {
+    EXPECT_THROW(
+        solitaire.tryApplyMove(Move {MoveType::UncoverTableauPileTopCard, invalidTableauPileId}),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        solitaire.tryApplyMove(Move {MoveType::MoveTableauPileCardToFoundationPile,
+                                     lastTableauPileId, invalidFoundationPileId}),
+        std::runtime_error
+    );
+}
+
+TEST_F(SolitaireTransactionTest, commitTransactionWithoutMovesWithoutHistoryRecord) {
+    EXPECT_CALL(*historyTrackerMock, save(_)).Times(0);
+    solitaire.commitTransaction();
+}
+
+TEST_F(SolitaireTransactionTest, snapshotEachTouchedPileOnceAndSaveOneHistoryRecord) {
+    auto& firstTableauPileMock = *tableauPileMocks[firstTableauPileId];
+    expectCheckingMoveBetweenTableauPiles(firstTableauPileMock, true);
+    expectNiceSnapshotCreation(lastTableauPileMock);
+    expectNiceSnapshotCreation(firstTableauPileMock);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(2, Ref(firstTableauPileMock)))
+        .WillOnce(Return(true));
+    EXPECT_CALL(firstTableauPileMock, canPullOutCards(1)).WillOnce(Return(true));
+    EXPECT_CALL(firstTableauPileMock, getCards()).WillOnce(ReturnRef(oneCard));
+    EXPECT_CALL(lastTableauPileMock, canAddCards(_, _)).WillOnce(Return(true));
+    EXPECT_CALL(firstTableauPileMock, tryMoveCards(1, Ref(lastTableauPileMock)))
+        .WillOnce(Return(true));
+    EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).WillOnce(Return(true));
+    EXPECT_CALL(lastTableauPileMock, tryUncoverTopCard());
+
+    EXPECT_TRUE(solitaire.tryApplyMove(moveLastToFirstTableauPile));
+    EXPECT_TRUE(solitaire.tryApplyMove(moveFirstToLastTableauPile));
+    EXPECT_TRUE(solitaire.tryApplyMove(uncoverLastTableauPileTopCard));
+
+    EXPECT_CALL(*historyTrackerMock, save(NotNull()));
+    solitaire.commitTransaction();
+}
+
+TEST_F(SolitaireTransactionTest, dontSnapshotPilesOnIllegalMoves) {
+    expectCheckingMoveBetweenTableauPiles(*tableauPileMocks[firstTableauPileId], false);
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(*tableauPileMocks[firstTableauPileId], createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(_, _)).Times(0);
+    EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).WillOnce(Return(false));
+
+    EXPECT_FALSE(solitaire.tryApplyMove(moveLastToFirstTableauPile));
+    EXPECT_FALSE(solitaire.tryApplyMove(uncoverLastTableauPileTopCard));
+
+    EXPECT_CALL(*historyTrackerMock, save(_)).Times(0);
+    solitaire.commitTransaction();
+}
+
+TEST_F(SolitaireTransactionTest, abortTransactionRestoresTouchedPilesWithoutHistoryRecord) {
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {};
+    expectCheckingMoveBetweenTableauPiles(*tableauPileMocks[firstTableauPileId], true);
+    expectSnapshotCreation(lastTableauPileMock, snapshotMock);
+    expectSnapshotCreation(*tableauPileMocks[firstTableauPileId], destinationSnapshotMock);
+    EXPECT_CALL(lastTableauPileMock, tryMoveCards(2, _)).WillOnce(Return(true));
+    EXPECT_TRUE(solitaire.tryApplyMove(moveLastToFirstTableauPile));
+
+    InSequence seq;
+    EXPECT_CALL(*destinationSnapshotMock, restore());
+    EXPECT_CALL(*snapshotMock, restore());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
+    EXPECT_CALL(*historyTrackerMock, save(_)).Times(0);
+
+    solitaire.abortTransaction();
+    solitaire.beginTransaction();
+}
+
+TEST_F(SolitaireTransactionTest, moveSelectedStockPileCardToFoundationPile) {
+    std::optional<Card> cardToAdd {oneCard.back()};
+    EXPECT_CALL(*stockPileMock, getSelectedCardIndex()).WillOnce(Return(0));
+    EXPECT_CALL(*stockPileMock, getCards()).WillOnce(ReturnRef(oneCard));
+
+    InSequence seq;
+    EXPECT_CALL(lastFoundationPileMock, canAddCard(oneCard.back())).WillOnce(Return(true));
+    expectNiceSnapshotCreation(lastFoundationPileMock);
+    expectTryingAddCardAndClearIt(lastFoundationPileMock, cardToAdd);
+    expectNiceSnapshotCreation(*stockPileMock);
+    EXPECT_CALL(*stockPileMock, tryPullOutCard()).WillOnce(Return(oneCard.back()));
+
+    EXPECT_TRUE(solitaire.tryApplyMove(moveStockPileCardToLastFoundationPile));
+}
+
+TEST_F(SolitaireTransactionTest, dontMoveStockPileCardWhenNoCardIsSelected) {
+    EXPECT_CALL(*stockPileMock, getSelectedCardIndex()).WillOnce(Return(std::nullopt));
+    EXPECT_CALL(lastFoundationPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(*stockPileMock, tryPullOutCard()).Times(0);
+
+    EXPECT_FALSE(solitaire.tryApplyMove(moveStockPileCardToLastFoundationPile));
+}
+
+TEST_F(SolitaireTransactionTest, moveFoundationPileCardToTableauPile) {
+    auto& firstTableauPileMock = *tableauPileMocks[firstTableauPileId];
+
+    InSequence seq;
+    EXPECT_CALL(lastFoundationPileMock, canPullOutCard()).WillOnce(Return(true));
+    EXPECT_CALL(lastFoundationPileMock, getCards()).WillOnce(ReturnRef(oneCard));
+    EXPECT_CALL(firstTableauPileMock, canAddCards(_, _))
+        .With(AllArgs(RangeEq(oneCard.begin(), oneCard.end())))
+        .WillOnce(Return(true));
+    expectNiceSnapshotCreation(firstTableauPileMock);
+    EXPECT_CALL(firstTableauPileMock, tryAddCards(_, _))
+        .With(AllArgs(RangeEq(oneCard.begin(), oneCard.end())))
+        .WillOnce(Return(true));
+    expectNiceSnapshotCreation(lastFoundationPileMock);
+    EXPECT_CALL(lastFoundationPileMock, tryPullOutCard()).WillOnce(Return(oneCard.back()));
+
+    EXPECT_TRUE(solitaire.tryApplyMove(moveLastFoundationPileCardToFirstTableauPile));
+}
+
+TEST_F(SolitaireTransactionTest, dontApplyMovesWhenGameIsFinished) {
+    solitaire.commitTransaction();
+    finishGame();
+    solitaire.beginTransaction();
+    EXPECT_CALL(lastTableauPileMock, isTopCardCovered()).Times(0);
+    EXPECT_FALSE(solitaire.tryApplyMove(uncoverLastTableauPileTopCard));
+}
+
+class SolitaireGameStateTest: public SolitaireEmptyHandTest {
+public:
+    SolitaireGameStateTest() {
+        gameState.cards = deck;
+        std::swap(gameState.cards[28], gameState.cards[39]);
+        gameState.tableauPilesSizes = {1, 2, 3, 4, 5, 6, 5};
+        gameState.tableauPilesTopCoveredCardPositions = {0, 1, 2, 3, 0, 5, 5};
+        gameState.foundationPilesSizes = {2, 0, 0, 1};
+        gameState.stockPileSelectedCardIndex = 4;
+    }
+
+    void expectGameStateIsNotImported() {
+        EXPECT_CALL(*historyTrackerMock, reset()).Times(0);
+        for (auto& pile: tableauPileMocks)
+            EXPECT_CALL(*pile, initialize(_, _, _)).Times(0);
+        for (auto& pile: foundationPileMocks)
+            EXPECT_CALL(*pile, initialize(_, _)).Times(0);
+        EXPECT_CALL(*stockPileMock, initialize(_, _, _)).Times(0);
+    }
+
+    void expectThrowOnImportingGameStateAndGameIsUnchanged() {
+        expectGameStateIsNotImported();
+        EXPECT_THROW(solitaire.importGameState(gameState), std::runtime_error);
+        EXPECT_FALSE(solitaire.isGameFinished());
+    }
+
+    template <class Pile>
+    void expectPileCards(Pile& pile, Cards& pileCards, const unsigned cardsCount) {
+        pileCards.assign(nextCard, std::next(nextCard, cardsCount));
+        EXPECT_CALL(pile, getCards()).WillRepeatedly(ReturnRef(pileCards));
+        nextCard += cardsCount;
+    }
+
+    template <class Pile>
+    auto& expectPileInitialization(Pile& pile, const unsigned cardsCount) {
+        const auto firstPileCard = nextCard;
+        nextCard += cardsCount;
+        return EXPECT_CALL(pile, initialize(_, _))
+            .With(AllArgs(RangeEq(firstPileCard, nextCard)));
+    }
+
+    GameState gameState;
+    Deck::const_iterator nextCard {gameState.cards.begin()};
+    std::array<Cards, tableauPilesCount> tableauPilesCards;
+    std::array<Cards, foundationPilesCount> foundationPilesCards;
+    Cards stockPileCards;
+};
+
+TEST_F(SolitaireGameStateTest, exportGameState) {
+    for (unsigned id = 0; id < tableauPilesCount; ++id) {
+        auto& pile = *tableauPileMocks[id];
+        expectPileCards(pile, tableauPilesCards[id], gameState.tableauPilesSizes[id]);
+        EXPECT_CALL(pile, getTopCoveredCardPosition())
+            .WillOnce(Return(gameState.tableauPilesTopCoveredCardPositions[id]));
+    }
+
+    for (unsigned id = 0; id < foundationPilesCount; ++id)
+        expectPileCards(*foundationPileMocks[id], foundationPilesCards[id],
+                        gameState.foundationPilesSizes[id]);
+
+    expectPileCards(*stockPileMock, stockPileCards,
+                    std::distance(nextCard, gameState.cards.cend()));
+    EXPECT_CALL(*stockPileMock, getSelectedCardIndex())
+        .WillOnce(Return(gameState.stockPileSelectedCardIndex));
+
+    EXPECT_EQ(solitaire.exportGameState(), gameState);
+}
+
+TEST_F(SolitaireGameStateTest, exportGameStateWithoutSelectedStockPileCard) {
+    for (auto& pile: tableauPileMocks)
+        EXPECT_CALL(*pile, getCards()).WillRepeatedly(ReturnRef(noCards));
+    for (auto& pile: foundationPileMocks)
+        EXPECT_CALL(*pile, getCards()).WillRepeatedly(ReturnRef(noCards));
+    EXPECT_CALL(*stockPileMock, getCards()).WillRepeatedly(ReturnRef(noCards));
+    EXPECT_CALL(*stockPileMock, getSelectedCardIndex()).WillOnce(Return(std::nullopt));
+
+    EXPECT_EQ(solitaire.exportGameState().stockPileSelectedCardIndex,
+              GameState::noSelectedStockPileCard);
+}
+
+TEST_F(SolitaireGameStateTest, importGameState) {
+    InSequence seq;
+    EXPECT_CALL(*historyTrackerMock, reset());
+
+    for (unsigned id = 0; id < tableauPilesCount; ++id) {
+        const auto firstPileCard = nextCard;
+        nextCard += gameState.tableauPilesSizes[id];
+        EXPECT_CALL(*tableauPileMocks[id],
+                    initialize(_, _, gameState.tableauPilesTopCoveredCardPositions[id]))
+            .With(Args<0, 1>(RangeEq(firstPileCard, nextCard)));
+    }
+
+    for (unsigned id = 0; id < foundationPilesCount; ++id)
+        expectPileInitialization(*foundationPileMocks[id], gameState.foundationPilesSizes[id]);
+
+    EXPECT_CALL(*stockPileMock, initialize(_, _, std::optional<unsigned> {4}))
+        .With(Args<0, 1>(RangeEq(nextCard, gameState.cards.cend())));
+
+    solitaire.importGameState(gameState);
+}
+
+TEST_F(SolitaireGameStateTest, importGameStateWithoutSelectedStockPileCard) {
+    gameState.stockPileSelectedCardIndex = GameState::noSelectedStockPileCard;
+
+    EXPECT_CALL(*historyTrackerMock, reset());
+    EXPECT_CALL(*stockPileMock, initialize(_, _, std::optional<unsigned> {}));
+
+    solitaire.importGameState(gameState);
+}
+
+TEST_F(SolitaireGameStateTest, throwExceptionOnImportingGameStateWithTooManyPilesCards) {
+    gameState.foundationPilesSizes[0] = 25;
+    EXPECT_THROW(solitaire.importGameState(gameState), std::runtime_error);
+}
+
+TEST_F(SolitaireGameStateTest, throwExceptionOnImportingGameStateWithDuplicatedCard) {
+    gameState.cards[0] = gameState.cards[1];
+    EXPECT_THROW(solitaire.importGameState(gameState), std::runtime_error);
+}
+
+TEST_F(SolitaireGameStateTest, throwExceptionOnImportingGameStateWithAllCardsInStockPile) {
+    gameState.tableauPilesSizes = {0, 0, 0, 0, 0, 0, 0};
+    gameState.tableauPilesTopCoveredCardPositions = {0, 0, 0, 0, 0, 0, 0};
+    gameState.foundationPilesSizes = {0, 0, 0, 0};
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest, throwExceptionOnImportingGameStateWithTooManyStockPileCards) {
+    gameState.foundationPilesSizes = {0, 0, 0, 0};
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest, throwExceptionOnImportingGameStateWithTooManyTableauPileCards) {
+    gameState.tableauPilesSizes = {25, 0, 0, 0, 0, 0, 1};
+    gameState.tableauPilesTopCoveredCardPositions = {0, 0, 0, 0, 0, 0, 0};
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest,
+       throwExceptionOnImportingGameStateWithTopCoveredCardPositionOutOfTableauPile)
+{
+    gameState.tableauPilesTopCoveredCardPositions[0] = 2;
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest,
+       throwExceptionOnImportingGameStateWithSelectedCardIndexOutOfStockPile)
+{
+    gameState.stockPileSelectedCardIndex = 23;
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest,
+       throwExceptionOnImportingGameStateWithFoundationPileNotStartingWithAce)
+{
+    std::swap(gameState.cards[26], gameState.cards[27]);
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest,
+       throwExceptionOnImportingGameStateWithFoundationPileOfDifferentSuits)
+{
+    std::swap(gameState.cards[27], gameState.cards[40]);
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
+TEST_F(SolitaireGameStateTest,
+       throwExceptionOnImportingGameStateWithFoundationPileNotInAscendingOrder)
+{
+    std::swap(gameState.cards[27], gameState.cards[39]);
+    expectThrowOnImportingGameStateAndGameIsUnchanged();
+}
+
 class SolitaireHandWithOneCardTest: public SolitaireEmptyHandTest {
 public:
     SolitaireHandWithOneCardTest() {
+        EXPECT_CALL(*stockPileMock, canPullOutCard()).WillOnce(Return(true));
         expectSnapshotCreation(*stockPileMock, snapshotMock);
         EXPECT_CALL(*stockPileMock, tryPullOutCard()).WillOnce(Return(oneCard.back()));
         expectSavingSourcePileSnapshot(snapshotMock);
@@ -432,28 +1188,59 @@ TEST_F(SolitaireHandWithOneCardTest, onNewGameClearHandAndDistributeCards) {
 
     solitaire.startNewGame();
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
+}
+
+TEST_F(SolitaireHandWithOneCardTest, throwExceptionOnExportingGameState) {
+    EXPECT_THROW(solitaire.exportGameState(), std::runtime_error);
+}
+
+TEST_F(SolitaireHandWithOneCardTest, putCardsBackOnImportingGameState) {
+    const auto gameState = GameState::fromDeck(deck);
+
+    InSequence seq;
+    EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, restoreSourcePile());
+    EXPECT_CALL(*historyTrackerMock, reset());
+
+    solitaire.importGameState(gameState);
+    EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
+}
+
+TEST_F(SolitaireHandWithOneCardTest, keepCardsInHandOnImportingInvalidGameState) {
+    GameState gameState {};
+    gameState.cards = deck;
+
+    EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, restoreSourcePile()).Times(0);
+    EXPECT_CALL(*historyTrackerMock, reset()).Times(0);
+
+    EXPECT_THROW(solitaire.importGameState(gameState), std::runtime_error);
+    EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(oneCard));
 }
 
 TEST_F(SolitaireHandWithOneCardTest, tryPutCardsBack) {
+    const std::array<Cards, foundationPilesCount> foundationPilesCards {};
+
+    InSequence seq;
     EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, restoreSourcePile());
+    expectFoundationPilesCardsCounting(foundationPilesCards);
     solitaire.tryPutCardsBackFromHand();
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
-TEST_F(SolitaireHandWithOneCardTest, ignoreSomeOperationsIfHandNotEmpty) {
-    ignoreEmptyHandPossibleOperationsTest();
+TEST_F(SolitaireHandWithOneCardTest, cannotAutoCompleteWithCardsInHand) {
+    for (auto& pile: tableauPileMocks)
+        EXPECT_CALL(*pile, getTopCoveredCardPosition()).WillRepeatedly(Return(0));
+    EXPECT_FALSE(solitaire.canAutoComplete());
 }
 
-TEST_F(SolitaireHandWithOneCardTest, ignoreSomeOperationsIfGameFinished) {
-    finishGame();
-
-    EXPECT_CALL(*moveCardsOperationSnapshotCreatorMock, restoreSourcePile()).Times(0);
-    EXPECT_CALL(lastFoundationPileMock, tryAddCard(_)).Times(0);
-    EXPECT_CALL(lastTableauPileMock, tryAddCards(_)).Times(0);
+TEST_F(SolitaireHandWithOneCardTest, throwExceptionOnBeginningTransaction) {
+    EXPECT_THROW(solitaire.beginTransaction(), std::runtime_error);
+}
 
-    solitaire.tryPutCardsBackFromHand();
-    solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
-    solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
+TEST_F(SolitaireHandWithOneCardTest, ignoreSomeOperationsIfHandNotEmpty) {
+    ignoreEmptyHandPossibleOperationsTest();
 }
 
 class SolitaireHandWithOneCardAddCardTest: public SolitaireHandWithOneCardTest
@@ -464,19 +1251,20 @@ public:
 };
 
 TEST_F(SolitaireHandWithOneCardAddCardTest, tryAddCardOnFoundationPileWithFail) {
-    std::optional<Card> cardToAdd {oneCard.back()};
-
-    EXPECT_CALL(lastFoundationPileMock, createSnapshot());
-    EXPECT_CALL(lastFoundationPileMock, tryAddCard(cardToAdd));
+    EXPECT_CALL(lastFoundationPileMock, canAddCard(oneCard.back())).WillOnce(Return(false));
+    EXPECT_CALL(lastFoundationPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastFoundationPileMock, tryAddCard(_)).Times(0);
 
     solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(oneCard));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {oneCard.begin(), oneCard.end()}));
 }
 
 TEST_F(SolitaireHandWithOneCardAddCardTest, addCardOnFoundationPileWithoutHistoryRecord) {
     std::optional<Card> cardToAdd {oneCard.back()};
 
     InSequence seq;
+    EXPECT_CALL(lastFoundationPileMock, canAddCard(oneCard.back())).WillOnce(Return(true));
     expectSnapshotCreation(lastFoundationPileMock, snapshotMock2);
     expectTryingAddCardAndClearIt(lastFoundationPileMock, cardToAdd);
     expectMoveOperationSnapshotCreation(snapshotMock2).WillOnce(ReturnNull());
@@ -484,12 +1272,14 @@ TEST_F(SolitaireHandWithOneCardAddCardTest, addCardOnFoundationPileWithoutHistor
 
     solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireHandWithOneCardAddCardTest, addCardOnFoundationPileWithHistoryRecord) {
     std::optional<Card> cardToAdd {oneCard.back()};
 
     InSequence seq;
+    EXPECT_CALL(lastFoundationPileMock, canAddCard(oneCard.back())).WillOnce(Return(true));
     expectSnapshotCreation(lastFoundationPileMock, snapshotMock2);
     expectTryingAddCardAndClearIt(lastFoundationPileMock, cardToAdd);
     expectMoveOperationSnapshotCreation(snapshotMock2)
@@ -498,11 +1288,14 @@ TEST_F(SolitaireHandWithOneCardAddCardTest, addCardOnFoundationPileWithHistoryRe
 
     solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 class SolitaireHandWithTwoCardsTest: public SolitaireEmptyHandTest {
 public:
     SolitaireHandWithTwoCardsTest() {
+        EXPECT_CALL(lastTableauPileMock, canPullOutCards(quantityToPullOut))
+            .WillOnce(Return(true));
         expectSnapshotCreation(lastTableauPileMock, snapshotMock);
         EXPECT_CALL(lastTableauPileMock, tryPullOutCards(quantityToPullOut))
             .WillOnce(Return(twoCards));
@@ -521,22 +1314,28 @@ TEST_F(SolitaireHandWithTwoCardsTest, ignoreTryOfAddingCardOnFoundationPile) {
 
     solitaire.tryAddCardOnFoundationPile(lastFoundationPileId);
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(twoCards));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {twoCards.begin(), twoCards.end()}));
 }
 
 TEST_F(SolitaireHandWithTwoCardsTest, tryAddCardOnTableauPileWithFail) {
-    auto cardsToAdd {twoCards};
-
-    EXPECT_CALL(lastTableauPileMock, createSnapshot());
-    EXPECT_CALL(lastTableauPileMock, tryAddCards(cardsToAdd));
+    EXPECT_CALL(lastTableauPileMock, canAddCards(_, _))
+        .With(AllArgs(RangeEq(twoCards.begin(), twoCards.end())))
+        .WillOnce(Return(false));
+    EXPECT_CALL(lastTableauPileMock, createSnapshot()).Times(0);
+    EXPECT_CALL(lastTableauPileMock, tryAddCards(_)).Times(0);
 
     solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
     EXPECT_THAT(solitaire.getCardsInHand(), ContainerEq(twoCards));
+    EXPECT_EQ(solitaire.getCardSetInHand(), (CardSet {twoCards.begin(), twoCards.end()}));
 }
 
 TEST_F(SolitaireHandWithTwoCardsTest, addCardOnTableauPileWithoutHistoryRecord) {
     auto cardsToAdd {twoCards};
 
     InSequence seq;
+    EXPECT_CALL(lastTableauPileMock, canAddCards(_, _))
+        .With(AllArgs(RangeEq(twoCards.begin(), twoCards.end())))
+        .WillOnce(Return(true));
     expectSnapshotCreation(lastTableauPileMock, snapshotMock2);
     expectTryingAddCardsAndClearThem(lastTableauPileMock, cardsToAdd);
     expectMoveOperationSnapshotCreation(snapshotMock2).WillOnce(ReturnNull());
@@ -544,12 +1343,16 @@ TEST_F(SolitaireHandWithTwoCardsTest, addCardOnTableauPileWithoutHistoryRecord)
 
     solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 TEST_F(SolitaireHandWithTwoCardsTest, addCardOnTableauPileWithHistoryRecord) {
     auto cardsToAdd {twoCards};
 
     InSequence seq;
+    EXPECT_CALL(lastTableauPileMock, canAddCards(_, _))
+        .With(AllArgs(RangeEq(twoCards.begin(), twoCards.end())))
+        .WillOnce(Return(true));
     expectSnapshotCreation(lastTableauPileMock, snapshotMock2);
     expectTryingAddCardsAndClearThem(lastTableauPileMock, cardsToAdd);
     expectMoveOperationSnapshotCreation(snapshotMock2)
@@ -558,6 +1361,7 @@ TEST_F(SolitaireHandWithTwoCardsTest, addCardOnTableauPileWithHistoryRecord) {
 
     solitaire.tryAddCardsOnTableauPile(lastTableauPileId);
     EXPECT_TRUE(solitaire.getCardsInHand().empty());
+    EXPECT_TRUE(solitaire.getCardSetInHand().empty());
 }
 
 }
@@ -0,0 +1,57 @@
+#include "archivers/CompositeSnapshot.h"
+#include "archivers/SnapshotMock.h"
+#include "gmock/gmock.h"
+#include "mock_ptr.h"
+
+using namespace testing;
+
+namespace solitaire::archivers {
+
+class CompositeSnapshotTests: public Test {
+public:
+    CompositeSnapshot::Snapshots createSnapshots() {
+        CompositeSnapshot::Snapshots snapshots;
+        snapshots.push_back(firstSnapshotMock.make_unique());
+        snapshots.push_back(secondSnapshotMock.make_unique());
+        return snapshots;
+    }
+
+    mock_ptr<SnapshotMock> firstSnapshotMock;
+    mock_ptr<SnapshotMock> secondSnapshotMock;
+};
+
+TEST_F(CompositeSnapshotTests, throwOnNullptrSnapshot) {
+    auto snapshots = createSnapshots();
+    snapshots.push_back(nullptr);
+    EXPECT_THROW(CompositeSnapshot {std::move(snapshots)}, std::runtime_error);
+}
+
+TEST_F(CompositeSnapshotTests, restoreSnapshotsInReverseOrder) {
+    CompositeSnapshot snapshot {createSnapshots()};
+
+    InSequence seq;
+    EXPECT_CALL(*secondSnapshotMock, restore());
+    EXPECT_CALL(*firstSnapshotMock, restore());
+    snapshot.restore();
+}
+
+TEST_F(CompositeSnapshotTests, isNotSnapshotOfAnyObject) {
+    const CompositeSnapshot snapshot {createSnapshots()};
+    EXPECT_FALSE(snapshot.isSnapshotOfSameObject(*firstSnapshotMock));
+    EXPECT_EQ(snapshot.getObjectKey(), nullptr);
+}
+
+TEST_F(CompositeSnapshotTests, memoryUsageIncludesPartSnapshots) {
+    constexpr std::size_t firstSnapshotMemoryUsage {100};
+    constexpr std::size_t secondSnapshotMemoryUsage {200};
+    const CompositeSnapshot snapshot {createSnapshots()};
+
+    EXPECT_CALL(*firstSnapshotMock, getMemoryUsage())
+        .WillOnce(Return(firstSnapshotMemoryUsage));
+    EXPECT_CALL(*secondSnapshotMock, getMemoryUsage())
+        .WillOnce(Return(secondSnapshotMemoryUsage));
+    EXPECT_GT(snapshot.getMemoryUsage(),
+              sizeof(CompositeSnapshot) + firstSnapshotMemoryUsage + secondSnapshotMemoryUsage);
+}
+
+}
@@ -1,23 +1,67 @@
+#include <vector>
+
 #include "archivers/HistoryTracker.h"
 #include "archivers/SnapshotMock.h"
+#include "archivers/SnapshotsPool.h"
+#include "cards/Card.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
 #include "gmock/gmock.h"
 #include "mock_ptr.h"
+#include "piles/FoundationPile.h"
 
 using namespace testing;
+using namespace solitaire::cards;
 
 namespace solitaire::archivers {
 
 namespace {
-constexpr unsigned maxHistorySize {2};
+constexpr std::size_t snapshotMemoryUsage {1024};
+constexpr std::size_t memoryLimit {2 * snapshotMemoryUsage + 1024};
+
+class CountingSnapshot: public interfaces::Snapshot {
+public:
+    explicit CountingSnapshot(std::size_t& memoryUsageQueriesCount):
+        memoryUsageQueriesCount {memoryUsageQueriesCount} {
+    }
+
+    void restore() const override {
+    }
+
+    bool isSnapshotOfSameObject(const interfaces::Snapshot&) const override {
+        return false;
+    }
+
+    const void* getObjectKey() const override {
+        return this;
+    }
+
+    std::size_t getMemoryUsage() const override {
+        ++memoryUsageQueriesCount;
+        return snapshotMemoryUsage;
+    }
+
+private:
+    std::size_t& memoryUsageQueriesCount;
+};
 }
 
 class HistoryTrackerTests: public Test {
 public:
-    HistoryTracker historyTracker {maxHistorySize};
+    template <class SnapshotMockType>
+    void saveSnapshot(mock_ptr<SnapshotMockType>& snapshotMock,
+                      const std::size_t memoryUsage = snapshotMemoryUsage)
+    {
+        EXPECT_CALL(*snapshotMock, getMemoryUsage()).WillRepeatedly(Return(memoryUsage));
+        historyTracker.save(snapshotMock.make_unique());
+    }
+
+    HistoryTracker historyTracker {memoryLimit};
 };
 
 TEST_F(HistoryTrackerTests, historyIsEmpty) {
     EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getMemoryUsage(), 0);
 }
 
 TEST_F(HistoryTrackerTests, undoShouldThrowIfHistoryEmpty) {
@@ -30,37 +74,117 @@ TEST_F(HistoryTrackerTests, onSaveShouldThrowIfPassedNullptr) {
 
 TEST_F(HistoryTrackerTests, onSaveHistorySizeShouldIncrease) {
     mock_ptr<SnapshotMock> snapshotMock;
-    historyTracker.save(snapshotMock.make_unique());
+    saveSnapshot(snapshotMock);
     EXPECT_EQ(historyTracker.getHistorySize(), 1);
+    EXPECT_GT(historyTracker.getMemoryUsage(), snapshotMemoryUsage);
+    EXPECT_LE(historyTracker.getMemoryUsage(), memoryLimit);
+}
+
+TEST_F(HistoryTrackerTests, keepNewestSnapshotEvenIfItExceedsMemoryLimit) {
+    mock_ptr<SnapshotMock> snapshotMock;
+    mock_ptr<StrictMock<SnapshotMock>> hugeSnapshotMock;
+    saveSnapshot(snapshotMock);
+    saveSnapshot(hugeSnapshotMock, 2 * memoryLimit);
+    EXPECT_EQ(historyTracker.getHistorySize(), 1);
+
+    EXPECT_CALL(*hugeSnapshotMock, restore());
+    historyTracker.undo();
+}
+
+TEST_F(HistoryTrackerTests, keepManySmallSnapshotsAndUndoThemInReverseOrder) {
+    constexpr std::size_t snapshotsCount {100};
+    HistoryTracker unlimitedHistoryTracker {snapshotsCount * snapshotMemoryUsage};
+    std::vector<std::size_t> restoredSnapshots;
+
+    for (std::size_t id = 0; id < snapshotsCount; ++id) {
+        auto snapshotMock = std::make_unique<NiceMock<SnapshotMock>>();
+        ON_CALL(*snapshotMock, getMemoryUsage()).WillByDefault(Return(1));
+        ON_CALL(*snapshotMock, restore()).WillByDefault(Invoke([&restoredSnapshots, id] {
+            restoredSnapshots.push_back(id);
+        }));
+        unlimitedHistoryTracker.save(std::move(snapshotMock));
+    }
+    EXPECT_EQ(unlimitedHistoryTracker.getHistorySize(), snapshotsCount);
+
+    while (unlimitedHistoryTracker.getHistorySize() > 0)
+        unlimitedHistoryTracker.undo();
+
+    ASSERT_EQ(restoredSnapshots.size(), snapshotsCount);
+    for (std::size_t id = 0; id < snapshotsCount; ++id)
+        EXPECT_EQ(restoredSnapshots[id], snapshotsCount - id - 1);
+}
+
+TEST_F(HistoryTrackerTests, measureMemoryUsageOfEachSnapshotConstantNumberOfTimes) {
+    constexpr std::size_t snapshotsCount {10000};
+    HistoryTracker largeHistoryTracker {snapshotsCount * snapshotMemoryUsage};
+    std::size_t memoryUsageQueriesCount {0};
+
+    for (std::size_t id = 0; id < snapshotsCount; ++id)
+        largeHistoryTracker.save(std::make_unique<CountingSnapshot>(memoryUsageQueriesCount));
+
+    EXPECT_GT(largeHistoryTracker.getHistorySize(), snapshotsCount / 2);
+    EXPECT_LT(largeHistoryTracker.getHistorySize(), snapshotsCount);
+    EXPECT_LE(largeHistoryTracker.getMemoryUsage(), snapshotsCount * snapshotMemoryUsage);
+    EXPECT_LE(memoryUsageQueriesCount, 8 * snapshotsCount);
+}
+
+TEST_F(HistoryTrackerTests, keepMemoryOfPilesSnapshotsAndJournalsUnderLimit) {
+    constexpr std::size_t cardMovesPerSnapshot {100};
+    constexpr std::size_t snapshotsCount {100};
+    const auto pile = std::make_shared<piles::FoundationPile>();
+    pile->initialize();
+
+    for (std::size_t id = 0; id < snapshotsCount; ++id) {
+        historyTracker.save(pile->createSnapshot());
+        for (std::size_t move = 0; move < cardMovesPerSnapshot; ++move) {
+            std::optional<Card> card {Card {Value::Ace, Suit::Heart}};
+            pile->tryAddCard(card);
+            pile->tryPullOutCard();
+        }
+    }
+
+    const auto historySize = historyTracker.getHistorySize();
+    const auto journalsMemoryUsage = historySize * cardMovesPerSnapshot * 2;
+    const auto snapshotsMemoryUsage = historySize * SnapshotsPool::getBlockSize();
+    EXPECT_GT(historySize, 1);
+    EXPECT_LT(historySize, snapshotsCount);
+    EXPECT_LE(journalsMemoryUsage + snapshotsMemoryUsage, memoryLimit);
+    EXPECT_GE(historyTracker.getMemoryUsage(), journalsMemoryUsage + snapshotsMemoryUsage);
 }
 
 class HistoryTrackerWithOneSnapshotTests: public HistoryTrackerTests {
 public:
     HistoryTrackerWithOneSnapshotTests() {
-        historyTracker.save(snapshotMock.make_unique());
+        saveSnapshot(snapshotMock);
     }
 
     mock_ptr<StrictMock<SnapshotMock>> snapshotMock;
 };
 
 TEST_F(HistoryTrackerWithOneSnapshotTests, onUndoRestoreAndRemoveSnapshot) {
+    const auto memoryUsage = historyTracker.getMemoryUsage();
+
     EXPECT_CALL(*snapshotMock, restore());
     historyTracker.undo();
     EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getMemoryUsage(), memoryUsage - snapshotMemoryUsage);
 }
 
 class FullHistoryTrackerTests: public HistoryTrackerWithOneSnapshotTests {
 public:
     FullHistoryTrackerTests() {
-        historyTracker.save(snapshotMock2.make_unique());
+        saveSnapshot(snapshotMock2);
     }
 
     mock_ptr<SnapshotMock> snapshotMock2;
 };
 
 TEST_F(FullHistoryTrackerTests, resetShouldClearHistory) {
+    const auto memoryUsage = historyTracker.getMemoryUsage();
+
     historyTracker.reset();
     EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getMemoryUsage(), memoryUsage - 2 * snapshotMemoryUsage);
 }
 
 TEST_F(FullHistoryTrackerTests, onUndoRestoreSnapshotsInReverseOrder) {
@@ -73,9 +197,11 @@ TEST_F(FullHistoryTrackerTests, onUndoRestoreSnapshotsInReverseOrder) {
     EXPECT_EQ(historyTracker.getHistorySize(), 0);
 }
 
-TEST_F(FullHistoryTrackerTests, removeFirstSnapshotOnSaveWhenHistoryFull) {
+TEST_F(FullHistoryTrackerTests, removeFirstSnapshotOnSaveWhenMemoryLimitIsExceeded) {
     mock_ptr<SnapshotMock> snapshotMock3;
-    historyTracker.save(snapshotMock3.make_unique());
+    saveSnapshot(snapshotMock3);
+    EXPECT_EQ(historyTracker.getHistorySize(), 2);
+    EXPECT_LE(historyTracker.getMemoryUsage(), memoryLimit);
 
     EXPECT_CALL(*snapshotMock3, restore());
     historyTracker.undo();
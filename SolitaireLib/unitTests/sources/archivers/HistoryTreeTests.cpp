@@ -0,0 +1,167 @@
+#include <random>
+#include <vector>
+
+#include "archivers/HistoryTree.h"
+#include "cards/SeededDeckGenerator.h"
+#include "gmock/gmock.h"
+#include "moves/MoveGenerator.h"
+#include "moves/ReversibleMoves.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+using namespace solitaire::moves;
+
+namespace solitaire::archivers {
+
+namespace {
+constexpr std::uint64_t seed {7};
+constexpr unsigned checkpointInterval {4};
+constexpr unsigned randomMovesCount {200};
+
+const Move illegalMove {MoveType::MoveFoundationPileCardToTableauPile, 0, 0};
+}
+
+class HistoryTreeTests: public Test {
+public:
+    HistoryTreeTests():
+        initialGameState {GameState::fromDeck(SeededDeckGenerator::generateDeal(seed, 0))},
+        historyTree {initialGameState, checkpointInterval}
+    {
+    }
+
+    Move getLegalMove(const GameState& gameState, const unsigned index = 0) const {
+        MoveGenerator::Moves moves;
+        const auto movesCount = MoveGenerator {gameState}.generate(moves);
+        return moves[index % movesCount];
+    }
+
+    GameState getGameStateAfterMove(GameState gameState, const Move& move) const {
+        applyMove(gameState, move);
+        return gameState;
+    }
+
+    const GameState initialGameState;
+    HistoryTree historyTree;
+};
+
+TEST_F(HistoryTreeTests, startAtRootWithInitialGameState) {
+    EXPECT_EQ(historyTree.getCurrentNodeId(), HistoryTree::rootNodeId);
+    EXPECT_EQ(historyTree.getGameState(), initialGameState);
+    EXPECT_EQ(historyTree.getNodesCount(), 1);
+    EXPECT_EQ(historyTree.getCheckpointsCount(), 1);
+    EXPECT_EQ(historyTree.getParentNodeId(HistoryTree::rootNodeId), std::nullopt);
+    EXPECT_THAT(historyTree.getChildrenNodesIds(HistoryTree::rootNodeId), IsEmpty());
+}
+
+TEST_F(HistoryTreeTests, throwExceptionOnZeroCheckpointInterval) {
+    EXPECT_THROW(HistoryTree(initialGameState, 0), std::runtime_error);
+}
+
+TEST_F(HistoryTreeTests, throwExceptionOnIllegalMove) {
+    EXPECT_THROW(historyTree.addMove(illegalMove), std::runtime_error);
+    EXPECT_EQ(historyTree.getNodesCount(), 1);
+}
+
+TEST_F(HistoryTreeTests, throwExceptionOnInvalidNodeId) {
+    EXPECT_THROW(historyTree.seek(1), std::runtime_error);
+    EXPECT_THROW(historyTree.getDepth(1), std::runtime_error);
+    EXPECT_THROW(historyTree.getMove(HistoryTree::rootNodeId), std::runtime_error);
+}
+
+TEST_F(HistoryTreeTests, tryUndoAndTryRedoReturnFalseIfThereIsNoNodeToGoTo) {
+    EXPECT_FALSE(historyTree.tryUndo());
+    EXPECT_FALSE(historyTree.tryRedo());
+}
+
+TEST_F(HistoryTreeTests, addMoveAppliesItOnGameStateAndUndoRevertsIt) {
+    const auto move = getLegalMove(initialGameState);
+    const auto nodeId = historyTree.addMove(move);
+
+    EXPECT_EQ(historyTree.getCurrentNodeId(), nodeId);
+    EXPECT_EQ(historyTree.getMove(nodeId), move);
+    EXPECT_EQ(historyTree.getDepth(nodeId), 1);
+    EXPECT_EQ(historyTree.getParentNodeId(nodeId), HistoryTree::rootNodeId);
+    EXPECT_EQ(historyTree.getGameState(), getGameStateAfterMove(initialGameState, move));
+
+    EXPECT_TRUE(historyTree.tryUndo());
+    EXPECT_EQ(historyTree.getCurrentNodeId(), HistoryTree::rootNodeId);
+    EXPECT_EQ(historyTree.getGameState(), initialGameState);
+
+    EXPECT_TRUE(historyTree.tryRedo());
+    EXPECT_EQ(historyTree.getCurrentNodeId(), nodeId);
+    EXPECT_EQ(historyTree.getGameState(), getGameStateAfterMove(initialGameState, move));
+}
+
+TEST_F(HistoryTreeTests, addingSameMoveAfterUndoReusesExistingNode) {
+    const auto move = getLegalMove(initialGameState);
+    const auto nodeId = historyTree.addMove(move);
+    historyTree.tryUndo();
+
+    EXPECT_EQ(historyTree.addMove(move), nodeId);
+    EXPECT_EQ(historyTree.getNodesCount(), 2);
+}
+
+TEST_F(HistoryTreeTests, addingDifferentMoveAfterUndoCreatesBranch) {
+    const auto firstMove = getLegalMove(initialGameState, 0);
+    const auto secondMove = getLegalMove(initialGameState, 1);
+    ASSERT_NE(firstMove, secondMove);
+
+    const auto firstNodeId = historyTree.addMove(firstMove);
+    historyTree.tryUndo();
+    const auto secondNodeId = historyTree.addMove(secondMove);
+
+    EXPECT_NE(firstNodeId, secondNodeId);
+    EXPECT_EQ(historyTree.getNodesCount(), 3);
+    EXPECT_THAT(historyTree.getChildrenNodesIds(HistoryTree::rootNodeId),
+                ElementsAre(firstNodeId, secondNodeId));
+
+    historyTree.seek(firstNodeId);
+    EXPECT_EQ(historyTree.getGameState(), getGameStateAfterMove(initialGameState, firstMove));
+}
+
+TEST_F(HistoryTreeTests, redoFollowsLastVisitedBranch) {
+    const auto firstNodeId = historyTree.addMove(getLegalMove(initialGameState, 0));
+    historyTree.tryUndo();
+    const auto secondNodeId = historyTree.addMove(getLegalMove(initialGameState, 1));
+    historyTree.tryUndo();
+
+    EXPECT_TRUE(historyTree.tryRedo());
+    EXPECT_EQ(historyTree.getCurrentNodeId(), secondNodeId);
+
+    historyTree.seek(firstNodeId);
+    historyTree.tryUndo();
+    EXPECT_TRUE(historyTree.tryRedo());
+    EXPECT_EQ(historyTree.getCurrentNodeId(), firstNodeId);
+}
+
+TEST_F(HistoryTreeTests, seekRestoresGameStateOfAnyNodeOnAnyBranch) {
+    std::mt19937 randomEngine {static_cast<std::mt19937::result_type>(seed)};
+    std::vector<GameState> nodesGameStates {initialGameState};
+
+    for (unsigned i = 0; i < randomMovesCount; ++i) {
+        if (i % 50 == 49)
+            historyTree.seek(randomEngine() % historyTree.getNodesCount());
+
+        MoveGenerator::Moves moves;
+        const auto movesCount = MoveGenerator {historyTree.getGameState()}.generate(moves);
+        if (movesCount == 0)
+            continue;
+
+        const auto nodeId = historyTree.addMove(moves[randomEngine() % movesCount]);
+        if (nodeId == nodesGameStates.size())
+            nodesGameStates.push_back(historyTree.getGameState());
+        ASSERT_EQ(historyTree.getGameState(), nodesGameStates[nodeId]);
+    }
+
+    ASSERT_EQ(historyTree.getNodesCount(), nodesGameStates.size());
+    EXPECT_LT(historyTree.getCheckpointsCount(), historyTree.getNodesCount() / 2);
+
+    for (unsigned i = 0; i < randomMovesCount; ++i) {
+        const HistoryTree::NodeId nodeId = randomEngine() % historyTree.getNodesCount();
+        historyTree.seek(nodeId);
+        EXPECT_EQ(historyTree.getCurrentNodeId(), nodeId);
+        ASSERT_EQ(historyTree.getGameState(), nodesGameStates[nodeId]) << nodeId;
+    }
+}
+
+}
@@ -92,6 +92,7 @@ TEST_F(MoveCardsOperationSnapshotCreatorWithSavedSourcePileTest,
     );
 
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(*snapshot));
+    EXPECT_EQ(snapshot->getObjectKey(), nullptr);
 }
 
 TEST_F(MoveCardsOperationSnapshotCreatorWithSavedSourcePileTest,
@@ -0,0 +1,117 @@
+#include "archivers/MoveRecordsHistoryTracker.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::archivers {
+
+namespace {
+constexpr std::size_t entryMemoryUsage {sizeof(MoveRecord) + sizeof(unsigned)};
+constexpr std::size_t memoryLimit {3 * entryMemoryUsage};
+
+const MoveRecord uncoverRecord {MoveRecord::Type::UncoverTableauPileTopCard, 3, 3};
+const MoveRecord selectRecord {MoveRecord::Type::SelectNextStockPileCard, 11, 11};
+const MoveRecord moveCardsRecord {MoveRecord::Type::MoveCards, 4, 1, 2};
+const MoveRecords transactionRecords {selectRecord, moveCardsRecord};
+}
+
+class MoveRecordsHistoryTrackerTests: public Test {
+public:
+    MoveRecordsHistoryTracker historyTracker {memoryLimit};
+};
+
+TEST_F(MoveRecordsHistoryTrackerTests, historyIsEmpty) {
+    EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getRedoSize(), 0);
+    EXPECT_EQ(historyTracker.getMemoryUsage(), 0);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, undoShouldThrowIfHistoryEmpty) {
+    EXPECT_THROW(historyTracker.undo(), std::runtime_error);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, redoShouldThrowIfNothingWasUndone) {
+    historyTracker.save(uncoverRecord);
+    EXPECT_THROW(historyTracker.redo(), std::runtime_error);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, onSaveShouldThrowIfPassedNoRecords) {
+    EXPECT_THROW(historyTracker.save(MoveRecords {}), std::runtime_error);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, onSaveHistorySizeShouldIncrease) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(transactionRecords);
+    EXPECT_EQ(historyTracker.getHistorySize(), 2);
+    EXPECT_EQ(historyTracker.getMemoryUsage(),
+              3 * sizeof(MoveRecord) + 2 * sizeof(unsigned));
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, undoReturnsRecordsOfEntriesInReverseOrder) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(transactionRecords);
+
+    EXPECT_EQ(historyTracker.undo(), transactionRecords);
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {uncoverRecord});
+    EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getRedoSize(), 2);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, redoReturnsUndoneEntriesInOrder) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(transactionRecords);
+    historyTracker.undo();
+    historyTracker.undo();
+
+    EXPECT_EQ(historyTracker.redo(), MoveRecords {uncoverRecord});
+    EXPECT_EQ(historyTracker.redo(), transactionRecords);
+    EXPECT_EQ(historyTracker.getHistorySize(), 2);
+    EXPECT_EQ(historyTracker.getRedoSize(), 0);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, saveDiscardsUndoneEntries) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(transactionRecords);
+    historyTracker.undo();
+    historyTracker.save(moveCardsRecord);
+
+    EXPECT_EQ(historyTracker.getHistorySize(), 2);
+    EXPECT_EQ(historyTracker.getRedoSize(), 0);
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {moveCardsRecord});
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {uncoverRecord});
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, resetClearsHistoryAndUndoneEntries) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(selectRecord);
+    historyTracker.undo();
+    historyTracker.reset();
+
+    EXPECT_EQ(historyTracker.getHistorySize(), 0);
+    EXPECT_EQ(historyTracker.getRedoSize(), 0);
+    EXPECT_EQ(historyTracker.getMemoryUsage(), 0);
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, removeOldestEntriesWhenMemoryLimitIsExceeded) {
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(selectRecord);
+    historyTracker.save(moveCardsRecord);
+    historyTracker.save(uncoverRecord);
+
+    EXPECT_EQ(historyTracker.getHistorySize(), 3);
+    EXPECT_LE(historyTracker.getMemoryUsage(), memoryLimit);
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {uncoverRecord});
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {moveCardsRecord});
+    EXPECT_EQ(historyTracker.undo(), MoveRecords {selectRecord});
+}
+
+TEST_F(MoveRecordsHistoryTrackerTests, keepNewestEntryEvenIfItExceedsMemoryLimit) {
+    const MoveRecords hugeEntryRecords(4, moveCardsRecord);
+    historyTracker.save(uncoverRecord);
+    historyTracker.save(hugeEntryRecords);
+
+    EXPECT_EQ(historyTracker.getHistorySize(), 1);
+    EXPECT_EQ(historyTracker.undo(), hugeEntryRecords);
+}
+
+}
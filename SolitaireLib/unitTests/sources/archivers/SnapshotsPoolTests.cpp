@@ -0,0 +1,105 @@
+#include "archivers/SnapshotsPool.h"
+#include "gmock/gmock.h"
+#include "piles/TableauPile.h"
+
+using namespace testing;
+
+namespace solitaire::archivers {
+
+namespace {
+constexpr std::size_t blocksCount {8};
+
+class PooledSnapshotStub: public PooledSnapshot {
+public:
+    void restore() const override {}
+    bool isSnapshotOfSameObject(const interfaces::Snapshot&) const override {
+        return false;
+    }
+    const void* getObjectKey() const override {
+        return nullptr;
+    }
+    std::size_t getMemoryUsage() const override {
+        return sizeof(*this);
+    }
+};
+}
+
+class SnapshotsPoolTests: public Test {
+public:
+    std::shared_ptr<SnapshotsPool> pool {std::make_shared<SnapshotsPool>(blocksCount)};
+};
+
+TEST_F(SnapshotsPoolTests, preallocateBlocks) {
+    EXPECT_EQ(pool->getBlocksCount(), blocksCount);
+    EXPECT_EQ(pool->getFreeBlocksCount(), blocksCount);
+}
+
+TEST_F(SnapshotsPoolTests, countPreallocatedBlocksInMemoryUsage) {
+    EXPECT_GE(SnapshotsPool::getBlockSize(), SnapshotsPool::maxSnapshotSize);
+    EXPECT_GE(pool->getMemoryUsage(), blocksCount * SnapshotsPool::getBlockSize());
+}
+
+TEST_F(SnapshotsPoolTests, reuseDeallocatedBlock) {
+    const auto snapshot = pool->allocate(SnapshotsPool::maxSnapshotSize);
+    EXPECT_EQ(pool->getFreeBlocksCount(), blocksCount - 1);
+
+    SnapshotsPool::deallocate(snapshot);
+    EXPECT_EQ(pool->getFreeBlocksCount(), blocksCount);
+    EXPECT_EQ(pool->allocate(SnapshotsPool::maxSnapshotSize), snapshot);
+    SnapshotsPool::deallocate(snapshot);
+}
+
+TEST_F(SnapshotsPoolTests, addBlocksWhenAllAreUsed) {
+    std::vector<std::unique_ptr<interfaces::Snapshot>> snapshots;
+    for (std::size_t i = 0; i <= blocksCount; ++i)
+        snapshots.emplace_back(new (*pool) PooledSnapshotStub);
+
+    EXPECT_GT(pool->getBlocksCount(), blocksCount);
+    snapshots.clear();
+    EXPECT_EQ(pool->getFreeBlocksCount(), pool->getBlocksCount());
+}
+
+TEST_F(SnapshotsPoolTests, growUpToMaxBlocksCount) {
+    constexpr std::size_t maxBlocksCount {blocksCount + blocksCount / 2};
+    const auto boundedPool = std::make_shared<SnapshotsPool>(blocksCount, maxBlocksCount);
+    std::vector<std::unique_ptr<interfaces::Snapshot>> snapshots;
+    for (std::size_t i = 0; i < maxBlocksCount; ++i)
+        snapshots.emplace_back(new (*boundedPool) PooledSnapshotStub);
+
+    EXPECT_EQ(boundedPool->getBlocksCount(), maxBlocksCount);
+    EXPECT_EQ(boundedPool->getFreeBlocksCount(), 0);
+    EXPECT_THROW(boundedPool->allocate(SnapshotsPool::maxSnapshotSize), std::runtime_error);
+
+    snapshots.pop_back();
+    EXPECT_NO_THROW(snapshots.emplace_back(new (*boundedPool) PooledSnapshotStub));
+}
+
+TEST_F(SnapshotsPoolTests, throwExceptionOnTooBigSnapshot) {
+    EXPECT_THROW(pool->allocate(SnapshotsPool::maxSnapshotSize + 1), std::runtime_error);
+}
+
+TEST_F(SnapshotsPoolTests, snapshotKeepsPoolAliveUntilItIsDeleted) {
+    std::unique_ptr<interfaces::Snapshot> snapshot {new (*pool) PooledSnapshotStub};
+    const std::weak_ptr<SnapshotsPool> weakPool {pool};
+
+    pool.reset();
+    EXPECT_FALSE(weakPool.expired());
+    snapshot.reset();
+    EXPECT_TRUE(weakPool.expired());
+}
+
+TEST_F(SnapshotsPoolTests, allocatePileSnapshotsFromPool) {
+    const auto pile = std::make_shared<piles::TableauPile>(pool);
+    auto snapshot = pile->createSnapshot();
+    EXPECT_EQ(pool->getFreeBlocksCount(), blocksCount - 1);
+
+    snapshot.reset();
+    EXPECT_EQ(pool->getFreeBlocksCount(), blocksCount);
+}
+
+TEST_F(SnapshotsPoolTests, chargeWholeBlockForPileSnapshot) {
+    const auto pile = std::make_shared<piles::TableauPile>(pool);
+    EXPECT_GE(pile->createSnapshot()->getMemoryUsage(), SnapshotsPool::getBlockSize());
+}
+
+}
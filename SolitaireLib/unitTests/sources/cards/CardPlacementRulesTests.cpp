@@ -0,0 +1,76 @@
+#include "cards/CardPlacementRules.h"
+#include "gtest/gtest.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+template <class Test>
+void forEachPairOfCards(Test test) {
+    for (int firstSuit = 0; firstSuit < 4; ++firstSuit)
+        for (int firstValue = 0; firstValue < 13; ++firstValue)
+            for (int secondSuit = 0; secondSuit < 4; ++secondSuit)
+                for (int secondValue = 0; secondValue < 13; ++secondValue)
+                    test(Card {Value {firstValue}, Suit {firstSuit}},
+                         Card {Value {secondValue}, Suit {secondSuit}});
+}
+}
+
+TEST(CardPlacementRulesTest, rulesAreConstexpr) {
+    constexpr Card kingOfHearts {Value::King, Suit::Heart};
+    constexpr Card queenOfSpades {Value::Queen, Suit::Spade};
+    constexpr Card aceOfClubs {Value::Ace, Suit::Club};
+    constexpr Card twoOfClubs {Value::Two, Suit::Club};
+
+    static_assert(canBePlacedOnTableauCard(queenOfSpades, kingOfHearts));
+    static_assert(not canBePlacedOnTableauCard(kingOfHearts, queenOfSpades));
+    static_assert(canBePlacedOnEmptyTableau(kingOfHearts));
+    static_assert(canFollowOnFoundation(twoOfClubs, aceOfClubs));
+    static_assert(not canFollowOnFoundation(aceOfClubs, twoOfClubs));
+    static_assert(canBePlacedOnEmptyFoundation(aceOfClubs));
+}
+
+TEST(CardPlacementRulesTest, cardCanBePlacedOnTableauCardOneGreaterWithDifferentColor) {
+    forEachPairOfCards([](const Card& card, const Card& tableauCard) {
+        EXPECT_EQ(canBePlacedOnTableauCard(card, tableauCard),
+                  tableauCard.hasValueOneGreaterThan(card) and
+                  tableauCard.hasDifferentColorThan(card));
+    });
+}
+
+TEST(CardPlacementRulesTest, cardCanFollowFoundationCardOneLowerWithSameSuit) {
+    forEachPairOfCards([](const Card& card, const Card& foundationCard) {
+        EXPECT_EQ(canFollowOnFoundation(card, foundationCard),
+                  card.hasValueOneGreaterThan(foundationCard) and
+                  card.hasSameSuitAs(foundationCard));
+    });
+}
+
+TEST(CardPlacementRulesTest, onlyKingCanBePlacedOnEmptyTableau) {
+    forEachPairOfCards([](const Card& card, const Card&) {
+        EXPECT_EQ(canBePlacedOnEmptyTableau(card), card.getValue() == Value::King);
+    });
+}
+
+TEST(CardPlacementRulesTest, onlyAceCanBePlacedOnEmptyFoundation) {
+    forEachPairOfCards([](const Card& card, const Card&) {
+        EXPECT_EQ(canBePlacedOnEmptyFoundation(card), card.getValue() == Value::Ace);
+    });
+}
+
+TEST(CardPlacementRulesTest, getCardsPlaceableOnTableauCard) {
+    const Card sevenOfDiamonds {Value::Seven, Suit::Diamond};
+    EXPECT_EQ(getCardsPlaceableOnTableauCard(sevenOfDiamonds),
+              getCardMask(Card {Value::Six, Suit::Spade}) |
+              getCardMask(Card {Value::Six, Suit::Club}));
+}
+
+TEST(CardPlacementRulesTest, getCardsFollowingOnFoundation) {
+    const Card sevenOfDiamonds {Value::Seven, Suit::Diamond};
+    EXPECT_EQ(getCardsFollowingOnFoundation(sevenOfDiamonds),
+              getCardMask(Card {Value::Eight, Suit::Diamond}));
+    EXPECT_EQ(getCardsFollowingOnFoundation(Card {Value::King, Suit::Diamond}), 0);
+}
+
+}
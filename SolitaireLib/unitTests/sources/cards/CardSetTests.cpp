@@ -0,0 +1,89 @@
+#include <sstream>
+
+#include "cards/CardSet.h"
+#include "cards/Cards.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gtest/gtest.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+const Card aceOfHearts {Value::Ace, Suit::Heart};
+const Card tenOfSpades {Value::Ten, Suit::Spade};
+const Card kingOfClubs {Value::King, Suit::Club};
+}
+
+TEST(CardSetTest, createEmptySet) {
+    CardSet cardSet;
+    EXPECT_TRUE(cardSet.empty());
+    EXPECT_EQ(cardSet.size(), 0);
+    EXPECT_FALSE(cardSet.contains(aceOfHearts));
+}
+
+TEST(CardSetTest, insertAndEraseCard) {
+    CardSet cardSet;
+
+    cardSet.insert(tenOfSpades);
+    EXPECT_TRUE(cardSet.contains(tenOfSpades));
+    EXPECT_FALSE(cardSet.contains(aceOfHearts));
+    EXPECT_EQ(cardSet.size(), 1);
+
+    cardSet.erase(tenOfSpades);
+    EXPECT_TRUE(cardSet.empty());
+}
+
+TEST(CardSetTest, createSetFromCards) {
+    const Cards cards {aceOfHearts, tenOfSpades, kingOfClubs};
+    const CardSet cardSet {cards.begin(), cards.end()};
+
+    EXPECT_EQ(cardSet.size(), 3);
+    for (const auto& card: cards)
+        EXPECT_TRUE(cardSet.contains(card));
+}
+
+TEST(CardSetTest, eraseCards) {
+    const Cards cards {aceOfHearts, tenOfSpades, kingOfClubs};
+    CardSet cardSet {cards.begin(), cards.end()};
+
+    cardSet.erase(std::next(cards.begin()), cards.end());
+    EXPECT_EQ(cardSet, (CardSet {cards.begin(), std::next(cards.begin())}));
+}
+
+TEST(CardSetTest, allCardsSetContainsEveryCard) {
+    constexpr auto allCards = CardSet::allCards();
+    static_assert(allCards.size() == 52);
+
+    for (int suit = 0; suit < 4; ++suit)
+        for (int value = 0; value < 13; ++value)
+            EXPECT_TRUE(allCards.contains(Card {Value {value}, Suit {suit}}));
+}
+
+TEST(CardSetTest, setOperations) {
+    const Cards lhsCards {aceOfHearts, tenOfSpades};
+    const Cards rhsCards {tenOfSpades, kingOfClubs};
+    const CardSet lhs {lhsCards.begin(), lhsCards.end()};
+    const CardSet rhs {rhsCards.begin(), rhsCards.end()};
+
+    const Cards sum {aceOfHearts, tenOfSpades, kingOfClubs};
+    const Cards intersection {tenOfSpades};
+    const Cards difference {aceOfHearts};
+
+    EXPECT_EQ(lhs | rhs, (CardSet {sum.begin(), sum.end()}));
+    EXPECT_EQ(lhs & rhs, (CardSet {intersection.begin(), intersection.end()}));
+    EXPECT_EQ(lhs - rhs, (CardSet {difference.begin(), difference.end()}));
+    EXPECT_NE(lhs, rhs);
+}
+
+TEST(CardSetTest, printCardSet) {
+    CardSet cardSet;
+    cardSet.insert(tenOfSpades);
+
+    std::stringstream stream;
+    stream << cardSet;
+    EXPECT_EQ(stream.str(), "CardSet {0x0000000002000000}");
+}
+
+}
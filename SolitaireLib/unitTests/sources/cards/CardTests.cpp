@@ -1,3 +1,5 @@
+#include <set>
+
 #include "cards/Card.h"
 #include "cards/Suit.h"
 #include "cards/Value.h"
@@ -19,6 +21,27 @@ TEST(CardTest, getValueAndSuit) {
     EXPECT_EQ(card.getSuit(), Suit::Diamond);
 }
 
+TEST(CardTest, cardIsPackedIntoOneByte) {
+    EXPECT_EQ(sizeof(Card), 1);
+}
+
+TEST(CardTest, eachCardHasUniqueCode) {
+    std::set<std::uint8_t> codes;
+    for (int suit = 0; suit < 4; ++suit)
+        for (int value = 0; value < 13; ++value)
+            codes.insert(Card {Value {value}, Suit {suit}}.getCode());
+    EXPECT_EQ(codes.size(), 52);
+}
+
+TEST(CardTest, predicatesAreConstexpr) {
+    constexpr Card kingOfHearts {Value::King, Suit::Heart};
+    constexpr Card queenOfSpades {Value::Queen, Suit::Spade};
+    static_assert(kingOfHearts.hasValueOneGreaterThan(queenOfSpades));
+    static_assert(kingOfHearts.hasDifferentColorThan(queenOfSpades));
+    static_assert(kingOfHearts.hasRedColor());
+    static_assert(not kingOfHearts.hasSameSuitAs(queenOfSpades));
+}
+
 TEST(CardTest, hasValueOneGreaterThanOtherCard) {
     const Suit heart = Suit::Heart;
     EXPECT_FALSE(Card (Value::King, heart).hasValueOneGreaterThan(Card {Value::King, heart}));
@@ -0,0 +1,93 @@
+#include <vector>
+
+#include "cards/Cards.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+const Card aceOfHearts {Value::Ace, Suit::Heart};
+const Card tenOfSpades {Value::Ten, Suit::Spade};
+const Card kingOfClubs {Value::King, Suit::Club};
+}
+
+TEST(CardsTest, cardsAreStoredInline) {
+    EXPECT_LE(sizeof(Cards), Cards::capacity + sizeof(std::uint64_t));
+}
+
+TEST(CardsTest, createEmptyCards) {
+    Cards cards;
+    EXPECT_TRUE(cards.empty());
+    EXPECT_EQ(cards.size(), 0);
+    EXPECT_EQ(cards.begin(), cards.end());
+}
+
+TEST(CardsTest, createCardsWithCount) {
+    Cards cards {3, tenOfSpades};
+    EXPECT_THAT(cards, ElementsAre(tenOfSpades, tenOfSpades, tenOfSpades));
+}
+
+TEST(CardsTest, pushBackAndPopBack) {
+    Cards cards;
+    cards.push_back(aceOfHearts);
+    cards.push_back(tenOfSpades);
+
+    EXPECT_EQ(cards.front(), aceOfHearts);
+    EXPECT_EQ(cards.back(), tenOfSpades);
+
+    cards.pop_back();
+    EXPECT_THAT(cards, ElementsAre(aceOfHearts));
+}
+
+TEST(CardsTest, insertCards) {
+    Cards cards {aceOfHearts, kingOfClubs};
+    const std::vector<Card> cardsToInsert {tenOfSpades, tenOfSpades};
+
+    cards.insert(std::next(cards.begin()), cardsToInsert.begin(), cardsToInsert.end());
+    EXPECT_THAT(cards, ElementsAre(aceOfHearts, tenOfSpades, tenOfSpades, kingOfClubs));
+
+    cards.insert(cards.begin(), cards.back());
+    EXPECT_EQ(cards.front(), kingOfClubs);
+}
+
+TEST(CardsTest, eraseCards) {
+    Cards cards {aceOfHearts, tenOfSpades, kingOfClubs, aceOfHearts};
+
+    cards.erase(std::next(cards.begin()));
+    EXPECT_THAT(cards, ElementsAre(aceOfHearts, kingOfClubs, aceOfHearts));
+
+    cards.erase(std::next(cards.begin()), cards.end());
+    EXPECT_THAT(cards, ElementsAre(aceOfHearts));
+}
+
+TEST(CardsTest, assignCards) {
+    Cards cards {aceOfHearts};
+    const std::vector<Card> cardsToAssign {tenOfSpades, kingOfClubs};
+
+    cards.assign(cardsToAssign.begin(), cardsToAssign.end());
+    EXPECT_THAT(cards, ElementsAre(tenOfSpades, kingOfClubs));
+}
+
+TEST(CardsTest, compareCards) {
+    EXPECT_EQ((Cards {aceOfHearts, tenOfSpades}), (Cards {aceOfHearts, tenOfSpades}));
+    EXPECT_NE((Cards {aceOfHearts, tenOfSpades}), (Cards {aceOfHearts}));
+    EXPECT_NE((Cards {aceOfHearts}), (Cards {tenOfSpades}));
+}
+
+TEST(CardsTest, throwExceptionOnAccessOutOfRange) {
+    Cards cards {aceOfHearts};
+    EXPECT_EQ(cards.at(0), aceOfHearts);
+    EXPECT_THROW(cards.at(1), std::out_of_range);
+}
+
+TEST(CardsTest, throwExceptionWhenCapacityExceeded) {
+    Cards cards {Cards::capacity, aceOfHearts};
+    EXPECT_THROW(cards.push_back(aceOfHearts), std::runtime_error);
+    EXPECT_THROW((Cards {Cards::capacity + 1, aceOfHearts}), std::runtime_error);
+}
+
+}
@@ -0,0 +1,21 @@
+#include "cards/Card.h"
+#include "cards/DealNumberDeckGenerator.h"
+#include "gtest/gtest.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+const DealNumber firstDealNumber {123456789};
+}
+
+TEST(DealNumberDeckGeneratorTest, generateDealsWithConsecutiveNumbers) {
+    DealNumberDeckGenerator generator {firstDealNumber};
+    auto dealNumber = firstDealNumber;
+
+    EXPECT_EQ(generator.generate(), dealNumber.toDeck());
+    EXPECT_EQ(generator.generate(), (++dealNumber).toDeck());
+}
+
+}
@@ -0,0 +1,98 @@
+#include <algorithm>
+
+#include "cards/Card.h"
+#include "cards/DealNumber.h"
+#include "cards/DeckGeneratorUtils.h"
+#include "cards/SeededDeckGenerator.h"
+#include "gtest/gtest.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+constexpr std::uint64_t seed {7};
+constexpr unsigned dealsToCheck {100};
+const std::string lastDealNumber {
+    "2fde529a3274c649cfeb4b180adb5cb9602a9e0638ab1ffffffffffff"};
+}
+
+class DealNumberTest: public Test {
+public:
+    const Deck sortedDeck {createSortedDeck()};
+};
+
+TEST_F(DealNumberTest, sortedDeckHasNumberZero) {
+    EXPECT_EQ(DealNumber::fromDeck(sortedDeck), DealNumber {0});
+    EXPECT_EQ(DealNumber {0}.toDeck(), sortedDeck);
+}
+
+TEST_F(DealNumberTest, deckWithSwappedLastCardsHasNumberOne) {
+    auto deck = sortedDeck;
+    std::swap(deck[50], deck[51]);
+
+    EXPECT_EQ(DealNumber::fromDeck(deck), DealNumber {1});
+    EXPECT_EQ(DealNumber {1}.toDeck(), deck);
+}
+
+TEST_F(DealNumberTest, reverselySortedDeckHasLastNumber) {
+    auto deck = sortedDeck;
+    std::reverse(deck.begin(), deck.end());
+
+    EXPECT_EQ(to_string(DealNumber::fromDeck(deck)), lastDealNumber);
+}
+
+TEST_F(DealNumberTest, convertDeckToNumberAndBack) {
+    for (unsigned dealNumber = 0; dealNumber < dealsToCheck; ++dealNumber) {
+        const auto deck = SeededDeckGenerator::generateDeal(seed, dealNumber);
+        EXPECT_EQ(DealNumber::fromDeck(deck).toDeck(), deck);
+    }
+}
+
+TEST_F(DealNumberTest, convertNumberToDeckAndBack) {
+    DealNumber::Words words {
+        0x89abcdef, 0x01234567, 0xfedcba98, 0x76543210,
+        0x00112233, 0x44556677, 0xfde529a2, 0x2
+    };
+    const DealNumber dealNumber {words};
+
+    EXPECT_EQ(DealNumber::fromDeck(dealNumber.toDeck()), dealNumber);
+}
+
+TEST_F(DealNumberTest, throwExceptionWhenDeckContainsDuplicatedCard) {
+    auto deck = sortedDeck;
+    deck[0] = deck[1];
+    EXPECT_THROW(DealNumber::fromDeck(deck), std::runtime_error);
+}
+
+TEST_F(DealNumberTest, throwExceptionWhenNumberIsOutOfRange) {
+    auto deck = sortedDeck;
+    std::reverse(deck.begin(), deck.end());
+    auto dealNumber = DealNumber::fromDeck(deck);
+    auto words = dealNumber.getWords();
+    ++words.back();
+
+    EXPECT_THROW(DealNumber {words}.toDeck(), std::runtime_error);
+}
+
+TEST_F(DealNumberTest, incrementNumber) {
+    DealNumber dealNumber {0xFFFFFFFF};
+    ++dealNumber;
+    EXPECT_EQ(dealNumber, DealNumber {0x100000000});
+}
+
+TEST_F(DealNumberTest, incrementLastNumberWrapsToZero) {
+    auto deck = sortedDeck;
+    std::reverse(deck.begin(), deck.end());
+    auto dealNumber = DealNumber::fromDeck(deck);
+
+    ++dealNumber;
+    EXPECT_EQ(dealNumber, DealNumber {0});
+}
+
+TEST_F(DealNumberTest, to_string) {
+    EXPECT_EQ(to_string(DealNumber {0}), "0");
+    EXPECT_EQ(to_string(DealNumber {0x1234abcdef}), "1234abcdef");
+}
+
+}
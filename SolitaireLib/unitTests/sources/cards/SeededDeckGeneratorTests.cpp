@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <vector>
+
+#include "cards/Card.h"
+#include "cards/DeckGeneratorUtils.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+constexpr std::uint64_t seed {42};
+constexpr std::uint64_t otherSeed {43};
+constexpr std::size_t batchSize {8};
+
+bool cardsComparator(const Card& lhs, const Card& rhs) {
+    return lhs.getCode() < rhs.getCode();
+}
+}
+
+class SeededDeckGeneratorTest: public Test {
+public:
+    SeededDeckGenerator generator {seed};
+};
+
+TEST_F(SeededDeckGeneratorTest, generateShuffledDeck) {
+    auto generatedDeck = generator.generate();
+    auto sortedDeck = createSortedDeck();
+
+    EXPECT_NE(generatedDeck, sortedDeck);
+
+    std::sort(generatedDeck.begin(), generatedDeck.end(), cardsComparator);
+    std::sort(sortedDeck.begin(), sortedDeck.end(), cardsComparator);
+    EXPECT_THAT(generatedDeck, ContainerEq(sortedDeck));
+}
+
+TEST_F(SeededDeckGeneratorTest, generatedDecksHaveDifferentOrder) {
+    EXPECT_NE(generator.generate(), generator.generate());
+}
+
+TEST_F(SeededDeckGeneratorTest, generatorsWithSameSeedGenerateSameDeals) {
+    SeededDeckGenerator otherGenerator {seed};
+    for (std::size_t i = 0; i < batchSize; ++i)
+        EXPECT_EQ(generator.generate(), otherGenerator.generate());
+}
+
+TEST_F(SeededDeckGeneratorTest, generatorsWithDifferentSeedsGenerateDifferentDeals) {
+    SeededDeckGenerator otherGenerator {otherSeed};
+    EXPECT_NE(generator.generate(), otherGenerator.generate());
+}
+
+TEST_F(SeededDeckGeneratorTest, generateConsecutiveDeals) {
+    for (std::uint64_t dealNumber = 0; dealNumber < batchSize; ++dealNumber)
+        EXPECT_EQ(generator.generate(),
+                  SeededDeckGenerator::generateDeal(seed, dealNumber));
+}
+
+TEST_F(SeededDeckGeneratorTest, generateDealsWithStride) {
+    SeededDeckGenerator oddDealsGenerator {seed, 1, 2};
+    EXPECT_EQ(oddDealsGenerator.generate(), SeededDeckGenerator::generateDeal(seed, 1));
+    EXPECT_EQ(oddDealsGenerator.generate(), SeededDeckGenerator::generateDeal(seed, 3));
+}
+
+TEST_F(SeededDeckGeneratorTest, generateBatch) {
+    std::vector<Deck> decks(batchSize);
+    SeededDeckGenerator::generateBatch(seed, decks.size(), decks.data());
+
+    for (std::uint64_t dealNumber = 0; dealNumber < batchSize; ++dealNumber)
+        EXPECT_EQ(decks[dealNumber], SeededDeckGenerator::generateDeal(seed, dealNumber));
+}
+
+TEST_F(SeededDeckGeneratorTest, generatedDealDoesNotDependOnPlatform) {
+    const auto deck = SeededDeckGenerator::generateDeal(seed, 0);
+    const std::vector<Card> firstCards {deck.begin(), std::next(deck.begin(), 8)};
+
+    EXPECT_THAT(firstCards, ElementsAre(
+        Card {Value::Two, Suit::Spade},
+        Card {Value::Three, Suit::Spade},
+        Card {Value::Jack, Suit::Club},
+        Card {Value::Seven, Suit::Heart},
+        Card {Value::Two, Suit::Diamond},
+        Card {Value::Jack, Suit::Diamond},
+        Card {Value::Seven, Suit::Spade},
+        Card {Value::Nine, Suit::Heart}
+    ));
+}
+
+}
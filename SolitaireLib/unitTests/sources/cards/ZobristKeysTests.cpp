@@ -0,0 +1,48 @@
+#include <set>
+
+#include "cards/DeckGeneratorUtils.h"
+#include "cards/ZobristKeys.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::cards {
+
+namespace {
+constexpr unsigned pilesCount {12};
+}
+
+TEST(ZobristKeysTest, keysOfAllCardsInAllLocationsOfAllPilesAreUniqueAndNonZero) {
+    std::set<std::uint64_t> keys;
+    for (unsigned pileIndex = 0; pileIndex < pilesCount; ++pileIndex)
+        for (unsigned location = 0; location < cardLocationsCount; ++location)
+            for (const auto& card: createSortedDeck()) {
+                const auto key = placeZobristHashOnPile(
+                    getZobristKey(static_cast<CardLocation>(location), card), pileIndex);
+                EXPECT_NE(key, 0);
+                keys.insert(key);
+            }
+
+    EXPECT_EQ(keys.size(), pilesCount * cardLocationsCount * 52);
+}
+
+TEST(ZobristKeysTest, hashOfCardsIsXorOfTheirKeys) {
+    const auto deck = createSortedDeck();
+    const auto location = CardLocation::TableauPileUncovered;
+
+    EXPECT_EQ(getZobristHash(deck.begin(), deck.begin(), location), 0);
+    EXPECT_EQ(getZobristHash(deck.begin(), std::next(deck.begin(), 2), location),
+              getZobristKey(location, deck[0]) ^ getZobristKey(location, deck[1]));
+}
+
+TEST(ZobristKeysTest, placingHashOnPileIsLinear) {
+    const auto deck = createSortedDeck();
+    const auto firstKey = getZobristKey(CardLocation::FoundationPile, deck[0]);
+    const auto secondKey = getZobristKey(CardLocation::FoundationPile, deck[1]);
+
+    EXPECT_EQ(placeZobristHashOnPile(firstKey, 0), firstKey);
+    EXPECT_EQ(placeZobristHashOnPile(firstKey ^ secondKey, 11),
+              placeZobristHashOnPile(firstKey, 11) ^ placeZobristHashOnPile(secondKey, 11));
+}
+
+}
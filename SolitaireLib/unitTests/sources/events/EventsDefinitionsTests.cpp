@@ -17,6 +17,11 @@ TEST(EventsDefinitionsTests, equalOperator) {
     EXPECT_TRUE(MouseLeftButtonDown {position1} == MouseLeftButtonDown {position1});
     EXPECT_FALSE(MouseLeftButtonDown {position1} == MouseLeftButtonDown {position2});
 
+    EXPECT_TRUE(MouseLeftButtonDoubleClick {position1} ==
+                MouseLeftButtonDoubleClick {position1});
+    EXPECT_FALSE(MouseLeftButtonDoubleClick {position1} ==
+                 MouseLeftButtonDoubleClick {position2});
+
     EXPECT_TRUE(MouseMove {position1} == MouseMove {position1});
     EXPECT_FALSE(MouseMove {position1} == MouseMove {position2});
 }
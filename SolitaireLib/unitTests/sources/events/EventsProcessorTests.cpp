@@ -40,6 +40,7 @@ constexpr Position cardsInHandPosition {46, 26};
 constexpr Position pilePosition {45, 93};
 
 constexpr MouseLeftButtonDown mouseLeftButtonDownEvent {Position {24, 51}};
+constexpr MouseLeftButtonDoubleClick mouseLeftButtonDoubleClickEvent {Position {24, 51}};
 constexpr MouseMove mouseMoveEvent {Position {99, 13}};
 }
 
@@ -353,6 +354,31 @@ TEST_F(EventsProcessorTests,
     eventsProcessor.processEvents();
 }
 
+TEST_F(EventsProcessorTests, tryAutoCompleteOnLeftButtonDoubleClickEvent) {
+    expectEvent(mouseLeftButtonDoubleClickEvent);
+    EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
+    EXPECT_CALL(solitaireMock, canAutoComplete()).WillOnce(Return(true));
+    EXPECT_CALL(solitaireMock, tryAutoComplete());
+    expectEvent(Quit {});
+    eventsProcessor.processEvents();
+}
+
+TEST_F(EventsProcessorTests,
+       processLeftButtonDoubleClickEventAsLeftButtonDownWhenCannotAutoComplete)
+{
+    expectEvent(mouseLeftButtonDoubleClickEvent);
+    EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
+    EXPECT_CALL(solitaireMock, canAutoComplete()).WillOnce(Return(false));
+    ignoreLeftButtonDownOnButtons();
+    ignoreLeftButtonDownOnFoundationPilesFromFirstTo(foundationPilesCount);
+    ignoreLeftButtonDownOnTableauPilesFromFirstTo(tableauPilesCount);
+    expectGetStockPileCollider();
+    acceptLeftButtonDownOnCoveredStockPileCards(
+        MouseLeftButtonDown {mouseLeftButtonDoubleClickEvent.position});
+    expectEvent(Quit {});
+    eventsProcessor.processEvents();
+}
+
 TEST_F(EventsProcessorTests, doNothingOnLeftButtonUpEventWhenHandIsEmpty) {
     expectEvent(MouseLeftButtonUp {});
     EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
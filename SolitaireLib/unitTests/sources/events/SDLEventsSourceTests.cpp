@@ -63,6 +63,7 @@ TEST_F(SDLEventsSourceTests, returnMouseLeftButtonDownEvent) {
     EXPECT_CALL(*sdlMock, pollEvent(_)).WillOnce(Invoke([](auto& event) {
         event.type = SDL_MOUSEBUTTONDOWN;
         event.button.button = SDL_BUTTON_LEFT;
+        event.button.clicks = 1;
         event.button.x = x;
         event.button.y = y;
         return 1;
@@ -72,6 +73,21 @@ TEST_F(SDLEventsSourceTests, returnMouseLeftButtonDownEvent) {
     EXPECT_EQ(std::get<MouseLeftButtonDown>(eventsSource.getEvent()), mouseLeftButtonDown);
 }
 
+TEST_F(SDLEventsSourceTests, returnMouseLeftButtonDoubleClickEvent) {
+    EXPECT_CALL(*sdlMock, pollEvent(_)).WillOnce(Invoke([](auto& event) {
+        event.type = SDL_MOUSEBUTTONDOWN;
+        event.button.button = SDL_BUTTON_LEFT;
+        event.button.clicks = 2;
+        event.button.x = x;
+        event.button.y = y;
+        return 1;
+    }));
+
+    MouseLeftButtonDoubleClick mouseLeftButtonDoubleClick {x, y};
+    EXPECT_EQ(std::get<MouseLeftButtonDoubleClick>(eventsSource.getEvent()),
+              mouseLeftButtonDoubleClick);
+}
+
 TEST_F(SDLEventsSourceTests, returnMouseLeftButtonUpEvent) {
     EXPECT_CALL(*sdlMock, pollEvent(_)).WillOnce(Invoke([](auto& event) {
         event.type = SDL_MOUSEBUTTONUP;
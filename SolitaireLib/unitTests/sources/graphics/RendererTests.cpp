@@ -15,16 +15,20 @@
 #include "graphics/GraphicsSystemMock.h"
 #include "graphics/Renderer.h"
 #include "interfaces/archivers/Snapshot.h"
+#include "moves/Move.h"
 #include "piles/FoundationPileMock.h"
 #include "piles/PileId.h"
 #include "piles/StockPileMock.h"
 #include "piles/TableauPileMock.h"
+#include "solvers/HintEngineMock.h"
 
 using namespace testing;
 using namespace solitaire::cards;
 using namespace solitaire::colliders;
 using namespace solitaire::geometry;
+using namespace solitaire::moves;
 using namespace solitaire::piles;
+using namespace solitaire::solvers;
 
 namespace solitaire::graphics {
 
@@ -64,6 +68,7 @@ constexpr Position stockPileLastCoveredCardPosition {20, 30};
 constexpr Position stockPileUncoveredCardsPosition {105, 30};
 constexpr Position stockPileLastUncoveredCardPosition {109, 30};
 constexpr Position cardsInHandPosition {15, 22};
+constexpr Position firstTableauPilePosition {16, 144};
 
 const Card fiveDiamond {Value::Five, Suit::Diamond};
 
@@ -269,6 +274,11 @@ public:
         }
     }
 
+    void expectGetHint(const std::optional<Move>& hint) {
+        EXPECT_CALL(contextMock, getHintEngine()).WillOnce(ReturnRef(hintEngineMock));
+        EXPECT_CALL(hintEngineMock, getHint()).WillOnce(Return(hint));
+    }
+
     void expectGetCardsInHand(const Cards& cardsInHand) {
         EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
         EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(cardsInHand));
@@ -310,11 +320,13 @@ public:
     TableauPileColliderMock tableauPileColliderMock;
     StockPileColliderMock stockPileColliderMock;
     StockPileMock stockPileMock;
+    HintEngineMock hintEngineMock;
 };
 
 TEST_F(CreatedRendererTests, renderSolitaireWithEmptyStockPile) {
     expectGetStockPileData(noCards, std::nullopt);
     expectRenderCardPlaceholder(stockPilePosition);
+    expectGetHint(std::nullopt);
     expectGetCardsInHand(noCards);
     EXPECT_CALL(*graphicsSystemMock, renderFrame());
     renderer.render();
@@ -329,6 +341,7 @@ TEST_F(CreatedRendererTests, renderStockPileWithCoveredCards) {
     expectGetStockPileData(threeCards, std::nullopt);
     expectGetStockPileCollider();
     expectRenderStockPileCoveredCards();
+    expectGetHint(std::nullopt);
     expectGetCardsInHand(noCards);
     EXPECT_CALL(*graphicsSystemMock, renderFrame());
     renderer.render();
@@ -344,6 +357,7 @@ TEST_F(CreatedRendererTests, renderStockPileWithUncoveredCards) {
     expectGetStockPileCollider();
     expectRenderCardPlaceholder(stockPilePosition);
     expectRenderStockPileUncoveredCards();
+    expectGetHint(std::nullopt);
     expectGetCardsInHand(noCards);
     EXPECT_CALL(*graphicsSystemMock, renderFrame());
 
@@ -360,6 +374,49 @@ TEST_F(CreatedRendererTests, renderStockPileWithCoveredAndUncoveredCards) {
     expectGetStockPileCollider();
     expectRenderStockPileCoveredCards();
     expectRenderStockPileUncoveredCards();
+    expectGetHint(std::nullopt);
+    expectGetCardsInHand(noCards);
+    EXPECT_CALL(*graphicsSystemMock, renderFrame());
+
+    renderer.render();
+}
+
+TEST_F(CreatedRendererTests, renderHintOfMoveFromTableauPileToFoundationPile) {
+    expectGetStockPileData(noCards, std::nullopt);
+    expectRenderCardPlaceholder(stockPilePosition);
+    expectGetHint(Move {MoveType::MoveTableauPileCardToFoundationPile, 1, 2});
+    EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
+    EXPECT_CALL(solitaireMock, getTableauPile(PileId {1}))
+        .WillOnce(ReturnRef(tableauPileMocks[1]));
+    EXPECT_CALL(tableauPileMocks[1], getCards()).WillOnce(ReturnRef(threeCards));
+    EXPECT_CALL(contextMock, getTableauPileCollider(PileId {1}))
+        .WillOnce(ReturnRef(tableauPileColliderMock));
+    EXPECT_CALL(tableauPileColliderMock, getCardPosition(threeCards.size() - 1))
+        .WillOnce(Return(pilePosition));
+    expectRenderCardPlaceholder(pilePosition);
+    EXPECT_CALL(contextMock, getFoundationPileCollider(PileId {2}))
+        .WillOnce(ReturnRef(foundationPileColliderMock));
+    EXPECT_CALL(foundationPileColliderMock, getPosition()).WillOnce(Return(pilePosition));
+    expectRenderCardPlaceholder(pilePosition);
+    expectGetCardsInHand(noCards);
+    EXPECT_CALL(*graphicsSystemMock, renderFrame());
+
+    renderer.render();
+}
+
+TEST_F(CreatedRendererTests, renderHintOfMoveFromFoundationPileToEmptyTableauPile) {
+    expectGetStockPileData(noCards, std::nullopt);
+    expectRenderCardPlaceholder(stockPilePosition);
+    expectGetHint(Move {MoveType::MoveFoundationPileCardToTableauPile, 3, 0});
+    EXPECT_CALL(contextMock, getFoundationPileCollider(PileId {3}))
+        .WillOnce(ReturnRef(foundationPileColliderMock));
+    EXPECT_CALL(foundationPileColliderMock, getPosition()).WillOnce(Return(pilePosition));
+    expectRenderCardPlaceholder(pilePosition);
+    EXPECT_CALL(contextMock, getSolitaire()).WillOnce(ReturnRef(solitaireMock));
+    EXPECT_CALL(solitaireMock, getTableauPile(PileId {0}))
+        .WillOnce(ReturnRef(tableauPileMocks[0]));
+    EXPECT_CALL(tableauPileMocks[0], getCards()).WillOnce(ReturnRef(noCards));
+    expectRenderCardPlaceholder(firstTableauPilePosition);
     expectGetCardsInHand(noCards);
     EXPECT_CALL(*graphicsSystemMock, renderFrame());
 
@@ -371,6 +428,7 @@ public:
     CardsInHandRendererTests() {
         expectGetStockPileData(noCards, std::nullopt);
         expectRenderCardPlaceholder(stockPilePosition);
+        expectGetHint(std::nullopt);
     }
 };
 
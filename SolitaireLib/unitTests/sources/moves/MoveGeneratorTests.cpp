@@ -0,0 +1,103 @@
+#include "GameStateUtils.h"
+#include "cards/Card.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+#include "moves/MoveGenerator.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+
+namespace solitaire::moves {
+
+namespace {
+const Cards noCards;
+}
+
+class MoveGeneratorTest: public Test {
+public:
+    std::vector<Move> generateMoves(const GameState& gameState) const {
+        MoveGenerator::Moves moves;
+        const auto movesCount = MoveGenerator {gameState}.generate(moves);
+        return std::vector<Move> {moves.begin(), std::next(moves.begin(), movesCount)};
+    }
+};
+
+TEST_F(MoveGeneratorTest, generateAllLegalMoves) {
+    const auto gameState = createGameState(
+        {
+            Cards {Card {Value::King, Suit::Spade}},
+            Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart}},
+            noCards,
+            Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+            Cards {Card {Value::Nine, Suit::Club}, Card {Value::Jack, Suit::Spade},
+                   Card {Value::Ten, Suit::Diamond}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Three, Suit::Heart}}
+        },
+        {0, 1, 0, 2, 1, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+            noCards,
+            noCards,
+            Cards {Card {Value::Ace, Suit::Club}, Card {Value::Two, Suit::Club}}
+        },
+        Cards {Card {Value::King, Suit::Diamond}},
+        0
+    );
+
+    EXPECT_THAT(generateMoves(gameState), ElementsAre(
+        Move {MoveType::UncoverTableauPileTopCard, 3},
+        Move {MoveType::MoveTableauPileCardToFoundationPile, 5, 1},
+        Move {MoveType::MoveTableauPileCardToFoundationPile, 5, 2},
+        Move {MoveType::MoveTableauPileCardToFoundationPile, 6, 0},
+        Move {MoveType::MoveTableauPileCardsToTableauPile, 0, 2, 1},
+        Move {MoveType::MoveTableauPileCardsToTableauPile, 1, 0, 1},
+        Move {MoveType::MoveTableauPileCardsToTableauPile, 4, 1, 2},
+        Move {MoveType::MoveStockPileCardToTableauPile, 0, 2},
+        Move {MoveType::MoveFoundationPileCardToTableauPile, 3, 6},
+        Move {MoveType::SelectNextStockPileCard}
+    ));
+}
+
+TEST_F(MoveGeneratorTest, generateStockPileCardMovesOnlyWhenCardIsSelected) {
+    const auto gameState = createGameState(
+        {noCards, noCards, noCards, noCards, noCards, noCards, noCards},
+        {0, 0, 0, 0, 0, 0, 0},
+        {noCards, noCards, noCards, noCards},
+        Cards {Card {Value::Ace, Suit::Spade}}
+    );
+
+    EXPECT_THAT(generateMoves(gameState), ElementsAre(
+        Move {MoveType::SelectNextStockPileCard}
+    ));
+}
+
+TEST_F(MoveGeneratorTest, moveStockPileCardToFoundationPile) {
+    auto gameState = createGameState(
+        {noCards, noCards, noCards, noCards, noCards, noCards, noCards},
+        {0, 0, 0, 0, 0, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Ace, Suit::Diamond}},
+            Cards {Card {Value::Ace, Suit::Club}}
+        },
+        Cards {Card {Value::Queen, Suit::Spade}, Card {Value::Two, Suit::Diamond}},
+        1
+    );
+
+    EXPECT_THAT(generateMoves(gameState), ElementsAre(
+        Move {MoveType::MoveStockPileCardToFoundationPile, 0, 2},
+        Move {MoveType::SelectNextStockPileCard}
+    ));
+}
+
+TEST_F(MoveGeneratorTest, generateNoMovesWhenGameIsFinished) {
+    GameState gameState {};
+    gameState.foundationPilesSizes = {13, 13, 13, 13};
+
+    EXPECT_THAT(generateMoves(gameState), IsEmpty());
+}
+
+}
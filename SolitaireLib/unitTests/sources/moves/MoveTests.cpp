@@ -0,0 +1,40 @@
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "moves/Move.h"
+
+using namespace testing;
+
+namespace solitaire::moves {
+
+TEST(MoveTest, defaultMoveIsStockPileCardSelection) {
+    constexpr Move move;
+    EXPECT_EQ(move.getType(), MoveType::SelectNextStockPileCard);
+    EXPECT_EQ(move.getCode(), 0);
+}
+
+TEST(MoveTest, packAllFieldsIntoTwoBytes) {
+    constexpr Move move {MoveType::MoveTableauPileCardsToTableauPile, 6, 5, 13};
+
+    EXPECT_EQ(sizeof(move), 2);
+    EXPECT_EQ(move.getType(), MoveType::MoveTableauPileCardsToTableauPile);
+    EXPECT_EQ(move.getSource(), 6);
+    EXPECT_EQ(move.getDestination(), 5);
+    EXPECT_EQ(move.getQuantity(), 13);
+}
+
+TEST(MoveTest, compareMoves) {
+    constexpr Move move {MoveType::MoveTableauPileCardToFoundationPile, 1, 2};
+
+    EXPECT_TRUE(move == (Move {MoveType::MoveTableauPileCardToFoundationPile, 1, 2}));
+    EXPECT_TRUE(move != (Move {MoveType::MoveTableauPileCardToFoundationPile, 2, 1}));
+}
+
+TEST(MoveTest, printMove) {
+    std::ostringstream stream;
+    stream << Move {MoveType::MoveFoundationPileCardToTableauPile, 3, 4};
+    EXPECT_EQ(stream.str(), "Move {type: MoveFoundationPileCardToTableauPile, "
+                            "source: 3, destination: 4, quantity: 1}");
+}
+
+}
@@ -0,0 +1,337 @@
+#include <random>
+#include <vector>
+
+#include "GameStateUtils.h"
+#include "Solitaire.h"
+#include "archivers/HistoryTracker.h"
+#include "archivers/MoveCardsOperationSnapshotCreator.h"
+#include "archivers/MoveRecordsHistoryTracker.h"
+#include "cards/Card.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+#include "moves/MoveGenerator.h"
+#include "moves/ReversibleMoves.h"
+#include "piles/FoundationPile.h"
+#include "piles/PileId.h"
+#include "piles/StockPile.h"
+#include "piles/TableauPile.h"
+
+using namespace testing;
+using namespace solitaire::archivers;
+using namespace solitaire::cards;
+using namespace solitaire::piles;
+
+namespace solitaire::moves {
+
+namespace {
+const Cards noCards;
+}
+
+class ReversibleMovesTest: public Test {
+public:
+    ReversibleMovesTest() {
+        initialGameState = createGameState(
+            {
+                Cards {Card {Value::King, Suit::Spade}},
+                Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart}},
+                noCards,
+                Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+                Cards {Card {Value::Nine, Suit::Club}, Card {Value::Jack, Suit::Spade},
+                       Card {Value::Ten, Suit::Diamond}},
+                Cards {Card {Value::Ace, Suit::Spade}},
+                Cards {Card {Value::Three, Suit::Heart}}
+            },
+            {0, 1, 0, 2, 1, 0, 0},
+            {
+                Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+                noCards,
+                noCards,
+                Cards {Card {Value::Ace, Suit::Club}, Card {Value::Two, Suit::Club}}
+            },
+            Cards {Card {Value::King, Suit::Diamond}, Card {Value::Ace, Suit::Diamond}},
+            0
+        );
+        gameState = initialGameState;
+    }
+
+    void expectMoveIsReversible(const Move& move, const GameState& expectedGameState) {
+        applyMove(gameState, move);
+        EXPECT_EQ(gameState, expectedGameState);
+        undoMove(gameState, move);
+        EXPECT_EQ(gameState, initialGameState);
+    }
+
+    GameState initialGameState;
+    GameState gameState;
+};
+
+TEST_F(ReversibleMovesTest, uncoverTableauPileTopCard) {
+    auto expectedGameState = initialGameState;
+    expectedGameState.tableauPilesTopCoveredCardPositions[3] = 1;
+
+    expectMoveIsReversible(Move {MoveType::UncoverTableauPileTopCard, 3}, expectedGameState);
+}
+
+TEST_F(ReversibleMovesTest, moveTableauPileCardsToTableauPile) {
+    const auto expectedGameState = createGameState(
+        {
+            Cards {Card {Value::King, Suit::Spade}},
+            Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart},
+                   Card {Value::Jack, Suit::Spade}, Card {Value::Ten, Suit::Diamond}},
+            noCards,
+            Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+            Cards {Card {Value::Nine, Suit::Club}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Three, Suit::Heart}}
+        },
+        {0, 1, 0, 2, 1, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+            noCards,
+            noCards,
+            Cards {Card {Value::Ace, Suit::Club}, Card {Value::Two, Suit::Club}}
+        },
+        Cards {Card {Value::King, Suit::Diamond}, Card {Value::Ace, Suit::Diamond}},
+        0
+    );
+
+    expectMoveIsReversible(
+        Move {MoveType::MoveTableauPileCardsToTableauPile, 4, 1, 2}, expectedGameState);
+}
+
+TEST_F(ReversibleMovesTest, moveFoundationPileCardToTableauPile) {
+    const auto expectedGameState = createGameState(
+        {
+            Cards {Card {Value::King, Suit::Spade}},
+            Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart}},
+            noCards,
+            Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+            Cards {Card {Value::Nine, Suit::Club}, Card {Value::Jack, Suit::Spade},
+                   Card {Value::Ten, Suit::Diamond}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Three, Suit::Heart}, Card {Value::Two, Suit::Club}}
+        },
+        {0, 1, 0, 2, 1, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+            noCards,
+            noCards,
+            Cards {Card {Value::Ace, Suit::Club}}
+        },
+        Cards {Card {Value::King, Suit::Diamond}, Card {Value::Ace, Suit::Diamond}},
+        0
+    );
+
+    expectMoveIsReversible(
+        Move {MoveType::MoveFoundationPileCardToTableauPile, 3, 6}, expectedGameState);
+}
+
+TEST_F(ReversibleMovesTest, moveStockPileCardToTableauPile) {
+    const auto expectedGameState = createGameState(
+        {
+            Cards {Card {Value::King, Suit::Spade}},
+            Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart}},
+            Cards {Card {Value::King, Suit::Diamond}},
+            Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+            Cards {Card {Value::Nine, Suit::Club}, Card {Value::Jack, Suit::Spade},
+                   Card {Value::Ten, Suit::Diamond}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Three, Suit::Heart}}
+        },
+        {0, 1, 0, 2, 1, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+            noCards,
+            noCards,
+            Cards {Card {Value::Ace, Suit::Club}, Card {Value::Two, Suit::Club}}
+        },
+        Cards {Card {Value::Ace, Suit::Diamond}}
+    );
+
+    expectMoveIsReversible(
+        Move {MoveType::MoveStockPileCardToTableauPile, 0, 2}, expectedGameState);
+}
+
+TEST_F(ReversibleMovesTest, moveSecondStockPileCardToFoundationPile) {
+    applyMove(gameState, Move {MoveType::SelectNextStockPileCard});
+    initialGameState = gameState;
+
+    const auto expectedGameState = createGameState(
+        {
+            Cards {Card {Value::King, Suit::Spade}},
+            Cards {Card {Value::Five, Suit::Heart}, Card {Value::Queen, Suit::Heart}},
+            noCards,
+            Cards {Card {Value::Five, Suit::Club}, Card {Value::Queen, Suit::Diamond}},
+            Cards {Card {Value::Nine, Suit::Club}, Card {Value::Jack, Suit::Spade},
+                   Card {Value::Ten, Suit::Diamond}},
+            Cards {Card {Value::Ace, Suit::Spade}},
+            Cards {Card {Value::Three, Suit::Heart}}
+        },
+        {0, 1, 0, 2, 1, 0, 0},
+        {
+            Cards {Card {Value::Ace, Suit::Heart}, Card {Value::Two, Suit::Heart}},
+            Cards {Card {Value::Ace, Suit::Diamond}},
+            noCards,
+            Cards {Card {Value::Ace, Suit::Club}, Card {Value::Two, Suit::Club}}
+        },
+        Cards {Card {Value::King, Suit::Diamond}},
+        0
+    );
+
+    expectMoveIsReversible(
+        Move {MoveType::MoveStockPileCardToFoundationPile, 0, 1}, expectedGameState);
+}
+
+TEST_F(ReversibleMovesTest, selectStockPileCardsAndWrapAround) {
+    const auto stockPileSize =
+        gameState.cards.size() - gameState.getPilesOffsets()[GameState::stockPileIndex];
+    std::vector<GameState> gameStates {gameState};
+
+    for (unsigned i = 0; i < stockPileSize; ++i) {
+        applyMove(gameState, Move {MoveType::SelectNextStockPileCard});
+        gameStates.push_back(gameState);
+    }
+
+    EXPECT_EQ(gameState.stockPileSelectedCardIndex, GameState::noSelectedStockPileCard);
+    applyMove(gameState, Move {MoveType::SelectNextStockPileCard});
+    EXPECT_EQ(gameState.stockPileSelectedCardIndex, 0);
+
+    for (auto expectedGameState = gameStates.rbegin();
+         expectedGameState != gameStates.rend(); ++expectedGameState)
+    {
+        undoMove(gameState, Move {MoveType::SelectNextStockPileCard});
+        EXPECT_EQ(gameState, *expectedGameState);
+    }
+}
+
+class ReversibleMovesSolitaireTest: public TestWithParam<std::uint64_t> {
+public:
+    static std::unique_ptr<Solitaire> makeSolitaire(
+        const std::uint64_t seed,
+        std::unique_ptr<MoveRecordsHistoryTracker> moveRecordsHistoryTracker = nullptr)
+    {
+        Solitaire::FoundationPiles foundationPiles;
+        for (auto& pile: foundationPiles)
+            pile = std::make_shared<FoundationPile>();
+
+        Solitaire::TableauPiles tableauPiles;
+        for (auto& pile: tableauPiles)
+            pile = std::make_shared<TableauPile>();
+
+        return std::make_unique<Solitaire>(
+            std::make_unique<SeededDeckGenerator>(seed),
+            std::make_shared<StockPile>(),
+            foundationPiles, tableauPiles,
+            std::make_unique<HistoryTracker>(historyMemoryLimit),
+            std::make_unique<MoveCardsOperationSnapshotCreator>(),
+            std::move(moveRecordsHistoryTracker)
+        );
+    }
+
+    void applyMoveOnSolitaire(const Move& move) {
+        const PileId source {move.getSource()};
+        const PileId destination {move.getDestination()};
+
+        switch (move.getType()) {
+            case MoveType::SelectNextStockPileCard:
+                solitaire->trySelectNextStockPileCard();
+                break;
+            case MoveType::UncoverTableauPileTopCard:
+                solitaire->tryUncoverTableauPileTopCard(source);
+                break;
+            case MoveType::MoveStockPileCardToTableauPile:
+                solitaire->tryPullOutCardFromStockPile();
+                solitaire->tryAddCardsOnTableauPile(destination);
+                break;
+            case MoveType::MoveStockPileCardToFoundationPile:
+                solitaire->tryPullOutCardFromStockPile();
+                solitaire->tryAddCardOnFoundationPile(destination);
+                break;
+            case MoveType::MoveTableauPileCardsToTableauPile:
+                solitaire->tryMoveCardsBetweenTableauPiles(
+                    source, move.getQuantity(), destination);
+                break;
+            case MoveType::MoveTableauPileCardToFoundationPile:
+                solitaire->tryMoveCardFromTableauPileToFoundationPile(source, destination);
+                break;
+            case MoveType::MoveFoundationPileCardToTableauPile:
+                solitaire->tryPullOutCardFromFoundationPile(source);
+                solitaire->tryAddCardsOnTableauPile(destination);
+                break;
+        }
+    }
+
+    void applyRandomMoves() {
+        solitaire->startNewGame();
+        gameState = GameState::fromDeck(SeededDeckGenerator::generateDeal(seed, 0));
+        ASSERT_EQ(solitaire->exportGameState(), gameState);
+
+        std::mt19937 randomEngine {static_cast<std::mt19937::result_type>(seed)};
+        MoveGenerator::Moves moves;
+
+        for (unsigned i = 0; i < movesCount; ++i) {
+            const auto generatedMovesCount = MoveGenerator {gameState}.generate(moves);
+            if (generatedMovesCount == 0)
+                break;
+
+            const auto move = moves[randomEngine() % generatedMovesCount];
+            gameStates.push_back(gameState);
+            appliedMoves.push_back(move);
+
+            applyMove(gameState, move);
+            applyMoveOnSolitaire(move);
+            ASSERT_EQ(solitaire->exportGameState(), gameState) << move;
+            ASSERT_EQ(solitaire->getPositionHash(), gameState.getPositionHash()) << move;
+        }
+    }
+
+    static constexpr unsigned movesCount {400};
+    static constexpr std::size_t historyMemoryLimit {1024 * 1024};
+
+    const std::uint64_t seed {GetParam()};
+    std::unique_ptr<Solitaire> solitaire {makeSolitaire(seed)};
+    GameState gameState;
+    std::vector<GameState> gameStates;
+    std::vector<Move> appliedMoves;
+};
+
+TEST_P(ReversibleMovesSolitaireTest, applyRandomMovesLikeSolitaireAndUndoThem) {
+    ASSERT_NO_FATAL_FAILURE(applyRandomMoves());
+
+    while (not appliedMoves.empty()) {
+        undoMove(gameState, appliedMoves.back());
+        solitaire->tryUndoOperation();
+        ASSERT_EQ(gameState, gameStates.back()) << appliedMoves.back();
+        ASSERT_EQ(solitaire->exportGameState(), gameState) << appliedMoves.back();
+        ASSERT_EQ(solitaire->getPositionHash(), gameState.getPositionHash())
+            << appliedMoves.back();
+        appliedMoves.pop_back();
+        gameStates.pop_back();
+    }
+}
+
+TEST_P(ReversibleMovesSolitaireTest, undoAndRedoRandomMovesUsingMoveRecordsHistory) {
+    solitaire = makeSolitaire(seed, std::make_unique<MoveRecordsHistoryTracker>());
+    ASSERT_NO_FATAL_FAILURE(applyRandomMoves());
+    const auto finalGameState = gameState;
+    gameStates.push_back(finalGameState);
+
+    for (auto state = std::next(gameStates.rbegin()); state != gameStates.rend(); ++state) {
+        solitaire->tryUndoOperation();
+        ASSERT_EQ(solitaire->exportGameState(), *state);
+        ASSERT_EQ(solitaire->getPositionHash(), state->getPositionHash());
+    }
+
+    for (auto state = std::next(gameStates.begin()); state != gameStates.end(); ++state) {
+        solitaire->tryRedoOperation();
+        ASSERT_EQ(solitaire->exportGameState(), *state);
+        ASSERT_EQ(solitaire->getPositionHash(), state->getPositionHash());
+    }
+    EXPECT_EQ(solitaire->exportGameState(), finalGameState);
+}
+
+INSTANTIATE_TEST_SUITE_P(Seeds, ReversibleMovesSolitaireTest, Values(1, 7, 42, 2021));
+
+}
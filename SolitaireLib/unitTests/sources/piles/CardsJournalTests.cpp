@@ -0,0 +1,173 @@
+#include <vector>
+
+#include "cards/Card.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+#include "piles/CardsJournal.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+
+namespace solitaire::piles {
+
+namespace {
+struct RolledBackEntry {
+    Card card;
+    bool isRemoval;
+    unsigned stackIndex;
+};
+
+bool operator==(const RolledBackEntry& lhs, const RolledBackEntry& rhs) {
+    return lhs.card == rhs.card and lhs.isRemoval == rhs.isRemoval and
+           lhs.stackIndex == rhs.stackIndex;
+}
+
+std::ostream& operator<<(std::ostream& os, const RolledBackEntry& entry) {
+    return os << "{" << entry.card << ", " << entry.isRemoval << ", "
+              << entry.stackIndex << "}";
+}
+}
+
+class CardsJournalTest: public Test {
+public:
+    std::vector<RolledBackEntry> rollBack(const CardsJournal::Position position) {
+        std::vector<RolledBackEntry> rolledBackEntries;
+        journal.rollBack(position, [&](const CardsJournal::Entry& entry) {
+            rolledBackEntries.push_back({entry.card, entry.isRemoval, entry.stackIndex});
+        });
+        return rolledBackEntries;
+    }
+
+    const Card aceOfHearts {Value::Ace, Suit::Heart};
+    const Card kingOfClubs {Value::King, Suit::Club};
+    const Card fiveOfSpades {Value::Five, Suit::Spade};
+
+    CardsJournal journal;
+};
+
+TEST_F(CardsJournalTest, doNotRecordWhenNoSnapshotIsAttached) {
+    journal.recordAddedCard(aceOfHearts);
+    journal.recordRemovedCard(kingOfClubs, 1);
+
+    EXPECT_EQ(journal.getEntriesCount(), 0);
+}
+
+TEST_F(CardsJournalTest, rollBackEntriesInReverseOrder) {
+    const auto position = journal.attachSnapshot();
+    const std::vector<Card> addedCards {aceOfHearts, fiveOfSpades};
+
+    journal.recordAddedCards(addedCards.begin(), addedCards.end());
+    journal.recordRemovedCard(kingOfClubs, 1);
+
+    EXPECT_THAT(rollBack(position), ElementsAre(
+        RolledBackEntry {kingOfClubs, true, 1},
+        RolledBackEntry {fiveOfSpades, false, 0},
+        RolledBackEntry {aceOfHearts, false, 0}
+    ));
+    EXPECT_EQ(journal.getEntriesCount(), 0);
+}
+
+TEST_F(CardsJournalTest, rollBackNestedSnapshots) {
+    const auto firstPosition = journal.attachSnapshot();
+    journal.recordAddedCard(aceOfHearts);
+    const auto secondPosition = journal.attachSnapshot();
+    journal.recordRemovedCard(kingOfClubs);
+
+    EXPECT_THAT(rollBack(secondPosition), ElementsAre(
+        RolledBackEntry {kingOfClubs, true, 0}
+    ));
+    EXPECT_THAT(rollBack(firstPosition), ElementsAre(
+        RolledBackEntry {aceOfHearts, false, 0}
+    ));
+}
+
+TEST_F(CardsJournalTest, discardEntriesOlderThanOldestAttachedSnapshot) {
+    const auto firstPosition = journal.attachSnapshot();
+    journal.recordAddedCard(aceOfHearts);
+    const auto secondPosition = journal.attachSnapshot();
+    journal.recordAddedCard(kingOfClubs);
+
+    journal.detachSnapshot(firstPosition);
+    EXPECT_EQ(journal.getEntriesCount(), 1);
+    EXPECT_THROW(rollBack(firstPosition), std::runtime_error);
+
+    journal.detachSnapshot(secondPosition);
+    EXPECT_EQ(journal.getEntriesCount(), 0);
+}
+
+TEST_F(CardsJournalTest, rollBackEntriesWrappedAroundStorage) {
+    auto oldestPosition = journal.attachSnapshot();
+    for (unsigned index = 0; index < 40; ++index)
+        journal.recordAddedCard(aceOfHearts);
+    const auto memoryUsage = journal.getMemoryUsage();
+
+    for (unsigned index = 0; index < 100; ++index) {
+        const auto position = journal.attachSnapshot();
+        journal.recordRemovedCard(kingOfClubs);
+        journal.recordAddedCard(fiveOfSpades, 1);
+        journal.detachSnapshot(oldestPosition);
+        oldestPosition = position;
+    }
+
+    EXPECT_EQ(journal.getMemoryUsage(), memoryUsage);
+    EXPECT_THAT(rollBack(oldestPosition), ElementsAre(
+        RolledBackEntry {fiveOfSpades, false, 1},
+        RolledBackEntry {kingOfClubs, true, 0}
+    ));
+}
+
+TEST_F(CardsJournalTest, reuseStorageAfterDetachingAllSnapshots) {
+    const auto record = [this] {
+        const auto position = journal.attachSnapshot();
+        for (unsigned index = 0; index < 100; ++index)
+            journal.recordAddedCard(aceOfHearts);
+        journal.detachSnapshot(position);
+    };
+
+    record();
+    const auto memoryUsage = journal.getMemoryUsage();
+    EXPECT_GE(memoryUsage, 100);
+
+    record();
+    EXPECT_EQ(journal.getMemoryUsage(), memoryUsage);
+}
+
+TEST_F(CardsJournalTest, chargeEachSnapshotWithEntriesRecordedUntilNextSnapshot) {
+    const auto firstPosition = journal.attachSnapshot();
+    journal.recordAddedCard(aceOfHearts);
+    journal.recordAddedCard(kingOfClubs);
+    const auto secondPosition = journal.attachSnapshot();
+    journal.recordRemovedCard(kingOfClubs);
+
+    EXPECT_EQ(journal.getMemoryUsagePinnedBy(firstPosition), 2);
+    EXPECT_EQ(journal.getMemoryUsagePinnedBy(secondPosition), 1);
+
+    rollBack(firstPosition);
+    EXPECT_EQ(journal.getMemoryUsagePinnedBy(firstPosition), 0);
+    EXPECT_EQ(journal.getMemoryUsagePinnedBy(secondPosition), 0);
+}
+
+TEST_F(CardsJournalTest, ignoreDetachingNotAttachedSnapshot) {
+    const auto position = journal.attachSnapshot();
+    journal.recordAddedCard(aceOfHearts);
+
+    EXPECT_NO_THROW(journal.detachSnapshot(position + 1));
+    EXPECT_EQ(journal.getEntriesCount(), 1);
+
+    journal.detachSnapshot(position);
+    EXPECT_NO_THROW(journal.detachSnapshot(position));
+    EXPECT_EQ(journal.getEntriesCount(), 0);
+}
+
+TEST_F(CardsJournalTest, throwExceptionOnRollingBackToPositionAfterJournalEnd) {
+    const auto firstPosition = journal.attachSnapshot();
+    journal.recordAddedCard(aceOfHearts);
+    const auto secondPosition = journal.attachSnapshot();
+
+    rollBack(firstPosition);
+
+    EXPECT_THROW(rollBack(secondPosition), std::runtime_error);
+}
+
+}
@@ -1,8 +1,11 @@
 #include "archivers/SnapshotMock.h"
 #include "cards/Card.h"
+#include "cards/CardSet.h"
 #include "cards/Suit.h"
 #include "cards/Value.h"
+#include "cards/ZobristKeys.h"
 #include "gmock/gmock.h"
+#include "piles/PileUtils.h"
 #include "piles/FoundationPile.h"
 
 using namespace testing;
@@ -25,9 +28,22 @@ public:
 
 TEST_F(EmptyFoundationPileTest, createPile) {
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
     EXPECT_EQ(pile->getTopCardValue(), std::nullopt);
 }
 
+TEST_F(EmptyFoundationPileTest, initializePileWithCards) {
+    const Cards cards {
+        Card {Value::Ace, Suit::Club},
+        Card {Value::Two, Suit::Club}
+    };
+
+    initializePile(*pile, cards);
+    EXPECT_THAT(pile->getCards(), ContainerEq(cards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cards.begin(), cards.end()}));
+    EXPECT_EQ(pile->getTopCardValue(), Value::Two);
+}
+
 TEST_F(EmptyFoundationPileTest, tryAddNotCard) {
     std::optional<Card> notCard = std::nullopt;
 
@@ -35,16 +51,19 @@ TEST_F(EmptyFoundationPileTest, tryAddNotCard) {
 
     EXPECT_EQ(notCard, std::nullopt);
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 TEST_F(EmptyFoundationPileTest, tryAddNotAce) {
     const Card cardToAddAfterOperation {Value::Two, Suit::Heart};
     std::optional<Card> cardToAdd = cardToAddAfterOperation;
 
+    EXPECT_FALSE(pile->canAddCard(cardToAddAfterOperation));
     pile->tryAddCard(cardToAdd);
 
     EXPECT_EQ(cardToAdd, cardToAddAfterOperation);
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 TEST_F(EmptyFoundationPileTest, tryAddAce) {
@@ -54,16 +73,20 @@ TEST_F(EmptyFoundationPileTest, tryAddAce) {
 
     std::optional<Card> cardToAdd = pileCards.front();
 
+    EXPECT_TRUE(pile->canAddCard(pileCards.front()));
     pile->tryAddCard(cardToAdd);
 
     EXPECT_EQ(cardToAdd, std::nullopt);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getTopCardValue(), Value::Ace);
 }
 
 TEST_F(EmptyFoundationPileTest, tryPullOutCard) {
+    EXPECT_FALSE(pile->canPullOutCard());
     EXPECT_EQ(pile->tryPullOutCard(), std::nullopt);
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 class FoundationPileWithAceTest: public EmptyFoundationPileTest {
@@ -86,6 +109,7 @@ TEST_F(FoundationPileWithAceTest, tryAddSameCardAsOnTopOfPile) {
 
     EXPECT_EQ(cardToAdd, sameCardAsOnTopOfPile);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(FoundationPileWithAceTest,
@@ -98,6 +122,7 @@ TEST_F(FoundationPileWithAceTest,
 
     EXPECT_EQ(cardToAdd, cardWithValueTwoGreaterThanOnTopOfPile);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(FoundationPileWithAceTest,
@@ -110,6 +135,7 @@ TEST_F(FoundationPileWithAceTest,
 
     EXPECT_EQ(cardToAdd, cardWithDifferentSuitThanOnTopOfPile);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(FoundationPileWithAceTest, tryAddTwoWithSameSuitAsOnTopOfPile) {
@@ -120,13 +146,16 @@ TEST_F(FoundationPileWithAceTest, tryAddTwoWithSameSuitAsOnTopOfPile) {
 
     EXPECT_EQ(cardToAdd, std::nullopt);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getTopCardValue(), Value::Two);
 }
 
 TEST_F(FoundationPileWithAceTest, tryPullOutCard) {
     const auto pulledOutCard = pileCards.back();
+    EXPECT_TRUE(pile->canPullOutCard());
     EXPECT_EQ(pile->tryPullOutCard(), pulledOutCard);
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 class FoundationPileWithTwoTest: public FoundationPileWithAceTest
@@ -146,22 +175,39 @@ TEST_F(FoundationPileWithTwoTest, tryPullOutCard) {
 
     EXPECT_EQ(pile->tryPullOutCard(), pulledOutCard);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+}
+
+TEST_F(FoundationPileWithTwoTest, updatePositionHashWhenCardsAreAddedAndPulledOut) {
+    EXPECT_EQ(pile->getPositionHash(), getZobristHash(
+        pileCards.begin(), pileCards.end(), CardLocation::FoundationPile));
+
+    pile->tryPullOutCard();
+    EXPECT_EQ(pile->getPositionHash(),
+              getZobristKey(CardLocation::FoundationPile, pileCards.front()));
+
+    pile->initialize();
+    EXPECT_EQ(pile->getPositionHash(), 0);
 }
 
 TEST_F(FoundationPileWithTwoTest, initializePileAfterOperations) {
     pile->initialize();
 
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
     EXPECT_EQ(pile->getTopCardValue(), std::nullopt);
 }
 
 TEST_F(FoundationPileWithTwoTest, restorePileStateUsingSnapshot) {
+    const auto positionHash = pile->getPositionHash();
     const auto snapshot = pile->createSnapshot();
     pile->initialize();
     snapshot->restore();
 
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getTopCardValue(), pileCards.back().getValue());
+    EXPECT_EQ(pile->getPositionHash(), positionHash);
 }
 
 TEST_F(FoundationPileWithTwoTest, isSnapshotOfSameObject) {
@@ -170,10 +216,13 @@ TEST_F(FoundationPileWithTwoTest, isSnapshotOfSameObject) {
     const auto snapshotOfSameObject = pile->createSnapshot();
     const auto snapshotOfSameTypeObject = std::make_shared<FoundationPile>()->createSnapshot();
     SnapshotMock snapshotOfDifferentTypeObject;
+    EXPECT_CALL(snapshotOfDifferentTypeObject, getObjectKey())
+        .WillOnce(Return(&snapshotOfDifferentTypeObject));
 
     EXPECT_TRUE(snapshot->isSnapshotOfSameObject(*snapshotOfSameObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(*snapshotOfSameTypeObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(snapshotOfDifferentTypeObject));
+    EXPECT_EQ(snapshot->getObjectKey(), pile.get());
 }
 
 }
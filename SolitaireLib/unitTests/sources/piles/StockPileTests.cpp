@@ -1,7 +1,9 @@
 #include "archivers/SnapshotMock.h"
 #include "cards/Card.h"
+#include "cards/CardSet.h"
 #include "cards/Suit.h"
 #include "cards/Value.h"
+#include "cards/ZobristKeys.h"
 #include "gmock/gmock.h"
 #include "piles/PileUtils.h"
 #include "piles/StockPile.h"
@@ -26,6 +28,7 @@ public:
 
 TEST_F(EmptyStockPileTest, createPile) {
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
     EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
 }
 
@@ -49,6 +52,7 @@ public:
 
 TEST_F(StockPileWithCardsTest, initializePileWithCards) {
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
 }
 
@@ -67,8 +71,10 @@ TEST_F(StockPileWithCardsTest, trySelectNextCard) {
 }
 
 TEST_F(StockPileWithCardsTest, tryPullOutCardWhenNoneIsSelected) {
+    EXPECT_FALSE(pile->canPullOutCard());
     EXPECT_EQ(pile->tryPullOutCard(), std::nullopt);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
 }
 
@@ -78,8 +84,10 @@ TEST_F(StockPileWithCardsTest, tryPullOutFirstCard) {
 
     pile->trySelectNextCard();
 
+    EXPECT_TRUE(pile->canPullOutCard());
     EXPECT_EQ(pile->tryPullOutCard(), firstCard);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
 }
 
@@ -93,6 +101,7 @@ TEST_F(StockPileWithCardsTest, tryPullOutSecondCard) {
 
     EXPECT_EQ(pile->tryPullOutCard(), secondCard);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), 0);
 }
 
@@ -106,9 +115,99 @@ TEST_F(StockPileWithCardsTest, tryPullOutLastCard) {
 
     EXPECT_EQ(pile->tryPullOutCard(), lastCard);
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), 1);
 }
 
+TEST_F(StockPileWithCardsTest, selectCardsAgainAfterPullingOutCardAndWrappingAround) {
+    const auto secondCard = pileCards[1];
+    pileCards.erase(std::next(pileCards.begin()));
+
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->tryPullOutCard(), secondCard);
+
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), 1);
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), 0);
+
+    EXPECT_EQ(pile->tryPullOutCard(), pileCards.front());
+    pileCards.erase(pileCards.begin());
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+}
+
+TEST_F(StockPileWithCardsTest, trySelectPreviousCardRevertsSelectingNextCard) {
+    const auto initialPositionHash = pile->getPositionHash();
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    const auto positionHash = pile->getPositionHash();
+
+    pile->trySelectNextCard();
+    pile->trySelectPreviousCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), 1);
+    EXPECT_EQ(pile->getPositionHash(), positionHash);
+
+    pile->trySelectPreviousCard();
+    pile->trySelectPreviousCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
+    EXPECT_EQ(pile->getPositionHash(), initialPositionHash);
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+}
+
+TEST_F(StockPileWithCardsTest, trySelectPreviousCardRevertsWrappingAround) {
+    for (unsigned i = 0; i <= pileCards.size(); ++i)
+        pile->trySelectNextCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
+
+    pile->trySelectPreviousCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), pileCards.size() - 1);
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getPositionHash(),
+              getZobristHash(pileCards.begin(), pileCards.end(), CardLocation::StockPileWaste));
+}
+
+TEST_F(StockPileWithCardsTest, putBackPulledOutCard) {
+    const auto positionHash = pile->getPositionHash();
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    const auto selectedCardPositionHash = pile->getPositionHash();
+    const auto pulledOutCard = pile->tryPullOutCard();
+    ASSERT_TRUE(pulledOutCard);
+
+    pile->putBackCard(pulledOutCard.value());
+    EXPECT_EQ(pile->getSelectedCardIndex(), 1);
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+    EXPECT_EQ(pile->getPositionHash(), selectedCardPositionHash);
+    EXPECT_NE(pile->getPositionHash(), positionHash);
+}
+
+TEST_F(StockPileWithCardsTest, updatePositionHashWhenCardsAreSelectedAndPulledOut) {
+    const auto initialPositionHash =
+        getZobristHash(pileCards.begin(), pileCards.end(), CardLocation::StockPileStock);
+    EXPECT_EQ(pile->getPositionHash(), initialPositionHash);
+
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getPositionHash(), initialPositionHash ^
+              getZobristKey(CardLocation::StockPileStock, pileCards[0]) ^
+              getZobristKey(CardLocation::StockPileWaste, pileCards[0]));
+
+    pile->tryPullOutCard();
+    const auto positionHashAfterPullOut =
+        initialPositionHash ^ getZobristKey(CardLocation::StockPileStock, pileCards[0]);
+    EXPECT_EQ(pile->getPositionHash(), positionHashAfterPullOut);
+
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    EXPECT_NE(pile->getPositionHash(), positionHashAfterPullOut);
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getPositionHash(), positionHashAfterPullOut);
+}
+
 class StockPileInitializationTest: public StockPileWithCardsTest {
 public:
     const Cards newPileCards {
@@ -121,16 +220,62 @@ TEST_F(StockPileInitializationTest, initializePileAfterOperations) {
     initializePile(*pile, newPileCards);
 
     EXPECT_THAT(pile->getCards(), ContainerEq(newPileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {newPileCards.begin(), newPileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), std::nullopt);
 }
 
+TEST_F(StockPileInitializationTest, initializePileWithSelectedCardIndex) {
+    initializePile(*pile, newPileCards, std::optional<unsigned> {0});
+
+    EXPECT_THAT(pile->getCards(), ContainerEq(newPileCards));
+    EXPECT_EQ(pile->getSelectedCardIndex(), 0);
+
+    pile->trySelectNextCard();
+    EXPECT_EQ(pile->getSelectedCardIndex(), 1);
+    EXPECT_EQ(pile->tryPullOutCard(), newPileCards.back());
+}
+
+TEST_F(StockPileInitializationTest, throwExceptionOnSelectedCardIndexAfterPileEnd) {
+    EXPECT_THROW(initializePile(*pile, newPileCards, std::optional<unsigned> {2}),
+                 std::runtime_error);
+}
+
 TEST_F(StockPileInitializationTest, restorePileStateUsingSnapshot) {
     pile->trySelectNextCard();
+    const auto positionHash = pile->getPositionHash();
     const auto snapshot = pile->createSnapshot();
     initializePile(*pile, newPileCards);
     snapshot->restore();
 
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+    EXPECT_EQ(pile->getSelectedCardIndex(), 0);
+    EXPECT_EQ(pile->getPositionHash(), positionHash);
+}
+
+TEST_F(StockPileWithCardsTest, restoreNestedSnapshotsAfterWrappingAround) {
+    pile->trySelectNextCard();
+    const auto firstSnapshot = pile->createSnapshot();
+
+    pile->trySelectNextCard();
+    pile->tryPullOutCard();
+    const auto secondSnapshot = pile->createSnapshot();
+
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    pile->trySelectNextCard();
+    pile->tryPullOutCard();
+
+    secondSnapshot->restore();
+    const Cards cardsAfterPullOut {pileCards[0], pileCards[2]};
+    EXPECT_THAT(pile->getCards(), ContainerEq(cardsAfterPullOut));
+    EXPECT_EQ(pile->getCardSet(),
+              (CardSet {cardsAfterPullOut.begin(), cardsAfterPullOut.end()}));
+    EXPECT_EQ(pile->getSelectedCardIndex(), 0);
+
+    firstSnapshot->restore();
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getSelectedCardIndex(), 0);
 }
 
@@ -140,10 +285,13 @@ TEST_F(StockPileInitializationTest, isSnapshotOfSameObject) {
     const auto snapshotOfSameObject = pile->createSnapshot();
     const auto snapshotOfSameTypeObject = std::make_shared<StockPile>()->createSnapshot();
     SnapshotMock snapshotOfDifferentTypeObject;
+    EXPECT_CALL(snapshotOfDifferentTypeObject, getObjectKey())
+        .WillOnce(Return(&snapshotOfDifferentTypeObject));
 
     EXPECT_TRUE(snapshot->isSnapshotOfSameObject(*snapshotOfSameObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(*snapshotOfSameTypeObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(snapshotOfDifferentTypeObject));
+    EXPECT_EQ(snapshot->getObjectKey(), pile.get());
 }
 
 }
@@ -1,8 +1,11 @@
 #include "archivers/SnapshotMock.h"
 #include "cards/Card.h"
+#include "cards/CardSet.h"
 #include "cards/Suit.h"
 #include "cards/Value.h"
+#include "cards/ZobristKeys.h"
 #include "gmock/gmock.h"
+#include "piles/FoundationPile.h"
 #include "piles/PileUtils.h"
 #include "piles/TableauPile.h"
 
@@ -26,6 +29,7 @@ public:
 
 TEST_F(EmptyTableauPileTest, createPile) {
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 0);
 }
 
@@ -36,6 +40,7 @@ TEST_F(EmptyTableauPileTest, initializePileWithOneCard) {
 
     initializePile(*pile, cards);
     EXPECT_THAT(pile->getCards(), ContainerEq(cards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cards.begin(), cards.end()}));
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 0);
 }
 
@@ -47,6 +52,7 @@ TEST_F(EmptyTableauPileTest, initializePileWithTwoCards) {
 
     initializePile(*pile, cards);
     EXPECT_THAT(pile->getCards(), ContainerEq(cards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cards.begin(), cards.end()}));
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 1);
 }
 
@@ -63,7 +69,29 @@ TEST_F(EmptyTableauPileTest, initializePileWithSevenCards) {
 
     initializePile(*pile, cards);
     EXPECT_THAT(pile->getCards(), ContainerEq(cards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cards.begin(), cards.end()}));
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 6);
+    EXPECT_EQ(pile->getCoveredCardSet(), (CardSet {cards.begin(), std::prev(cards.end())}));
+}
+
+TEST_F(EmptyTableauPileTest, initializePileWithTopCoveredCardPosition) {
+    const Cards cards {
+        Card {Value::Ace, Suit::Heart},
+        Card {Value::Queen, Suit::Spade},
+        Card {Value::Jack, Suit::Heart}
+    };
+
+    initializePile(*pile, cards, 1u);
+    EXPECT_THAT(pile->getCards(), ContainerEq(cards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cards.begin(), cards.end()}));
+    EXPECT_EQ(pile->getCoveredCardSet(), (CardSet {cards.begin(), std::next(cards.begin())}));
+    EXPECT_EQ(pile->getTopCoveredCardPosition(), 1);
+    EXPECT_FALSE(pile->isTopCardCovered());
+}
+
+TEST_F(EmptyTableauPileTest, throwExceptionOnTopCoveredCardPositionAfterPileEnd) {
+    const Cards cards {Card {Value::Ace, Suit::Heart}};
+    EXPECT_THROW(initializePile(*pile, cards, 2u), std::runtime_error);
 }
 
 TEST_F(EmptyTableauPileTest, tryAddNoCards) {
@@ -72,6 +100,7 @@ TEST_F(EmptyTableauPileTest, tryAddNoCards) {
 
     EXPECT_TRUE(noCardsToAdd.empty());
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 TEST_F(EmptyTableauPileTest, tryAddCardsWhenKingIsNotFirst) {
@@ -82,10 +111,12 @@ TEST_F(EmptyTableauPileTest, tryAddCardsWhenKingIsNotFirst) {
     };
     const auto cardsLeftAfterAdding = cardsToAdd;
 
+    EXPECT_FALSE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_THAT(cardsToAdd, ContainerEq(cardsLeftAfterAdding));
     EXPECT_TRUE(pile->getCards().empty());
+    EXPECT_TRUE(pile->getCardSet().empty());
 }
 
 TEST_F(EmptyTableauPileTest, tryAddCardsWhenKingIsFirst) {
@@ -96,10 +127,12 @@ TEST_F(EmptyTableauPileTest, tryAddCardsWhenKingIsFirst) {
     };
     const auto cardsInPileAfterAdding = cardsToAdd;
 
+    EXPECT_TRUE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_TRUE(cardsToAdd.empty());
     EXPECT_THAT(pile->getCards(), ContainerEq(cardsInPileAfterAdding));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cardsInPileAfterAdding.begin(), cardsInPileAfterAdding.end()}));
 }
 
 TEST_F(EmptyTableauPileTest, tryUncoverTopCard) {
@@ -145,10 +178,12 @@ TEST_F(TableauPileWithUncoveredTopCardTest,
     cardsToAdd.front() = Card {cardsToAdd.front().getValue(), Suit::Diamond};
     const auto cardsLeftAfterAdding = cardsToAdd;
 
+    EXPECT_FALSE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_THAT(cardsToAdd, ContainerEq(cardsLeftAfterAdding));
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(TableauPileWithUncoveredTopCardTest,
@@ -157,10 +192,12 @@ TEST_F(TableauPileWithUncoveredTopCardTest,
     cardsToAdd.front() = Card {Value::Three, cardsToAdd.front().getSuit()};
     const auto cardsLeftAfterAdding = cardsToAdd;
 
+    EXPECT_FALSE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_THAT(cardsToAdd, ContainerEq(cardsLeftAfterAdding));
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(TableauPileWithUncoveredTopCardTest,
@@ -168,10 +205,12 @@ TEST_F(TableauPileWithUncoveredTopCardTest,
 {
     const auto cardsInPileAfterAdding = concatenateCards(pileCards, cardsToAdd);
 
+    EXPECT_TRUE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_TRUE(cardsToAdd.empty());
     EXPECT_THAT(pile->getCards(), ContainerEq(cardsInPileAfterAdding));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cardsInPileAfterAdding.begin(), cardsInPileAfterAdding.end()}));
 }
 
 class TableauPileWithCoveredTopCardTest:
@@ -190,22 +229,74 @@ TEST_F(TableauPileWithCoveredTopCardTest, tryAddCardsOnCoveredTopCard) {
     };
     const auto cardsLeftAfterAdding = cardsToAdd;
 
+    EXPECT_FALSE(pile->canAddCards(cardsToAdd.begin(), cardsToAdd.end()));
     pile->tryAddCards(cardsToAdd);
 
     EXPECT_THAT(cardsToAdd, ContainerEq(cardsLeftAfterAdding));
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(TableauPileWithCoveredTopCardTest, tryUncoverTopCard) {
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 2);
+    EXPECT_EQ(pile->getCoveredCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 
     pile->tryUncoverTopCard();
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 1);
+    EXPECT_EQ(pile->getCoveredCardSet(),
+              (CardSet {pileCards.begin(), std::next(pileCards.begin())}));
 
     pile->tryUncoverTopCard();
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 1);
 }
 
+TEST_F(TableauPileWithCoveredTopCardTest, updatePositionHashWhenCardsChangeLocation) {
+    EXPECT_EQ(pile->getPositionHash(), getZobristHash(
+        pileCards.begin(), pileCards.end(), CardLocation::TableauPileCovered));
+
+    pile->tryUncoverTopCard();
+    const auto positionHashAfterUncovering =
+        getZobristKey(CardLocation::TableauPileCovered, pileCards.front()) ^
+        getZobristKey(CardLocation::TableauPileUncovered, pileCards.back());
+    EXPECT_EQ(pile->getPositionHash(), positionHashAfterUncovering);
+
+    const Card cardToAdd {Value::Nine, Suit::Diamond};
+    Cards cardsToAdd {cardToAdd};
+    pile->tryAddCards(cardsToAdd);
+    EXPECT_EQ(pile->getPositionHash(), positionHashAfterUncovering ^
+              getZobristKey(CardLocation::TableauPileUncovered, cardToAdd));
+
+    pile->tryPullOutCards(1);
+    EXPECT_EQ(pile->getPositionHash(), positionHashAfterUncovering);
+}
+
+TEST_F(TableauPileWithCoveredTopCardTest, tryCoverTopCardAfterUncoveringIt) {
+    const auto positionHash = pile->getPositionHash();
+    pile->tryUncoverTopCard();
+    pile->tryCoverTopCard();
+
+    EXPECT_EQ(pile->getTopCoveredCardPosition(), 2);
+    EXPECT_EQ(pile->getCoveredCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+    EXPECT_EQ(pile->getPositionHash(), positionHash);
+
+    pile->tryCoverTopCard();
+    EXPECT_EQ(pile->getTopCoveredCardPosition(), 2);
+}
+
+TEST_F(TableauPileWithCoveredTopCardTest, putBackCardsOnCoveredTopCard) {
+    const Cards cardsToPutBack {Card {Value::Nine, Suit::Diamond}};
+    const auto positionHash = pile->getPositionHash();
+    const auto cardsInPileAfterPuttingBack = concatenateCards(pileCards, cardsToPutBack);
+
+    pile->putBackCards(cardsToPutBack.begin(), cardsToPutBack.end());
+    EXPECT_THAT(pile->getCards(), ContainerEq(cardsInPileAfterPuttingBack));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {cardsInPileAfterPuttingBack.begin(),
+                                            cardsInPileAfterPuttingBack.end()}));
+    EXPECT_EQ(pile->getTopCoveredCardPosition(), 2);
+    EXPECT_EQ(pile->getPositionHash(), positionHash ^
+              getZobristKey(CardLocation::TableauPileUncovered, cardsToPutBack.back()));
+}
+
 class TableauPileWithUncoveredTopTwoCardsTest:
     public InitializedTableauPileTest
 {
@@ -221,19 +312,24 @@ public:
 };
 
 TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryPullOutZeroCards) {
+    EXPECT_FALSE(pile->canPullOutCards(0));
     EXPECT_TRUE(pile->tryPullOutCards(0).empty());
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryPullOutOneCard) {
+    EXPECT_TRUE(pile->canPullOutCards(1));
     const Cards pulledOutCards {pileCards.back()};
     pileCards.pop_back();
 
     EXPECT_THAT(pile->tryPullOutCards(1), ContainerEq(pulledOutCards));
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryPullOutTwoCards) {
+    EXPECT_TRUE(pile->canPullOutCards(2));
     const auto quantityOfCardsToPullOut = 2u;
 
     const auto firstCardToPullOut = std::prev(pileCards.end(), quantityOfCardsToPullOut);
@@ -242,11 +338,78 @@ TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryPullOutTwoCards) {
 
     EXPECT_THAT(pile->tryPullOutCards(quantityOfCardsToPullOut), ContainerEq(pulledOutCards));
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+}
+
+TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryMoveCardsOnCorrectPile) {
+    const auto destinationPile = std::make_shared<TableauPile>();
+    const Cards destinationPileCards {Card {Value::Six, Suit::Club}};
+    initializePile(*destinationPile, destinationPileCards);
+
+    const auto movedCards = concatenateCards(
+        destinationPileCards, Cards {std::prev(pileCards.end(), 2), pileCards.end()});
+    pileCards.erase(std::prev(pileCards.end(), 2), pileCards.end());
+
+    EXPECT_TRUE(pile->tryMoveCards(2, *destinationPile));
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+    EXPECT_THAT(destinationPile->getCards(), ContainerEq(movedCards));
+    EXPECT_EQ(destinationPile->getCardSet(), (CardSet {movedCards.begin(), movedCards.end()}));
+}
+
+TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryMoveCardsOnIncorrectPile) {
+    const auto destinationPile = std::make_shared<TableauPile>();
+    const Cards destinationPileCards {Card {Value::Six, Suit::Heart}};
+    initializePile(*destinationPile, destinationPileCards);
+
+    EXPECT_FALSE(pile->tryMoveCards(2, *destinationPile));
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_THAT(destinationPile->getCards(), ContainerEq(destinationPileCards));
+}
+
+TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryMoveCoveredOrNoCards) {
+    const auto destinationPile = std::make_shared<TableauPile>();
+
+    EXPECT_FALSE(pile->tryMoveCards(0, *destinationPile));
+    EXPECT_FALSE(pile->tryMoveCards(3, *destinationPile));
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_TRUE(destinationPile->getCards().empty());
+}
+
+TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryMoveTopCardOnIncorrectFoundationPile) {
+    FoundationPile destinationPile;
+
+    EXPECT_FALSE(pile->tryMoveTopCard(destinationPile));
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_TRUE(destinationPile.getCards().empty());
+}
+
+TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryMoveTopCardOnCorrectFoundationPile) {
+    FoundationPile destinationPile;
+    Cards destinationPileCards {
+        Card {Value::Ace, Suit::Club},
+        Card {Value::Two, Suit::Club},
+        Card {Value::Three, Suit::Club}
+    };
+    for (const auto& card: destinationPileCards) {
+        std::optional<Card> cardToAdd {card};
+        destinationPile.tryAddCard(cardToAdd);
+    }
+
+    destinationPileCards.push_back(pileCards.back());
+    pileCards.pop_back();
+
+    EXPECT_TRUE(pile->tryMoveTopCard(destinationPile));
+    EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
+    EXPECT_THAT(destinationPile.getCards(), ContainerEq(destinationPileCards));
 }
 
 TEST_F(TableauPileWithUncoveredTopTwoCardsTest, tryPullOutTooMuchCards) {
+    EXPECT_FALSE(pile->canPullOutCards(3));
     EXPECT_TRUE(pile->tryPullOutCards(3).empty());
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
 }
 
 class TableauPileInitializationTest:
@@ -262,16 +425,22 @@ public:
 TEST_F(TableauPileInitializationTest, initializePileAfterOperations) {
     initializePile(*pile, newPileCards);
     EXPECT_THAT(pile->getCards(), ContainerEq(newPileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {newPileCards.begin(), newPileCards.end()}));
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 1);
 }
 
 TEST_F(TableauPileInitializationTest, restorePileStateUsingSnapshot) {
+    const auto positionHash = pile->getPositionHash();
     const auto snapshot = pile->createSnapshot();
     initializePile(*pile, newPileCards);
     snapshot->restore();
 
     EXPECT_THAT(pile->getCards(), ContainerEq(pileCards));
+    EXPECT_EQ(pile->getCardSet(), (CardSet {pileCards.begin(), pileCards.end()}));
     EXPECT_EQ(pile->getTopCoveredCardPosition(), 2);
+    EXPECT_EQ(pile->getCoveredCardSet(),
+              (CardSet {pileCards.begin(), std::next(pileCards.begin(), 2)}));
+    EXPECT_EQ(pile->getPositionHash(), positionHash);
 }
 
 TEST_F(TableauPileInitializationTest, isSnapshotOfSameObject) {
@@ -280,10 +449,13 @@ TEST_F(TableauPileInitializationTest, isSnapshotOfSameObject) {
     const auto snapshotOfSameObject = pile->createSnapshot();
     const auto snapshotOfSameTypeObject = std::make_shared<TableauPile>()->createSnapshot();
     SnapshotMock snapshotOfDifferentTypeObject;
+    EXPECT_CALL(snapshotOfDifferentTypeObject, getObjectKey())
+        .WillOnce(Return(&snapshotOfDifferentTypeObject));
 
     EXPECT_TRUE(snapshot->isSnapshotOfSameObject(*snapshotOfSameObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(*snapshotOfSameTypeObject));
     EXPECT_FALSE(snapshot->isSnapshotOfSameObject(snapshotOfDifferentTypeObject));
+    EXPECT_EQ(snapshot->getObjectKey(), pile.get());
 }
 
 }
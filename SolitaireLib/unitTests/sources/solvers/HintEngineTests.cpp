@@ -0,0 +1,184 @@
+#include <chrono>
+#include <thread>
+
+#include "GameStateUtils.h"
+#include "SolitaireMock.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+#include "solvers/HintEngine.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+using namespace solitaire::moves;
+
+namespace solitaire::solvers {
+
+namespace {
+const Cards noCards;
+const Cards cardsInHand {Card {cards::Value::Queen, Suit::Spade}};
+constexpr std::uint64_t firstPositionHash {1};
+constexpr std::uint64_t secondPositionHash {2};
+constexpr auto hintTimeout = std::chrono::seconds {10};
+constexpr auto maxCancellationLatency = std::chrono::milliseconds {500};
+constexpr std::uint64_t hardDealsSeed {2021};
+constexpr std::uint64_t hardDealNumber {3};
+const SolverLimits longSearchLimits {
+    std::numeric_limits<std::uint64_t>::max(), std::chrono::seconds {60}, 20
+};
+
+GameState createGameStateWithLastCardsInTableauAndStockPiles() {
+    return createGameState(
+        {
+            Cards {Card {cards::Value::King, Suit::Spade}, Card {cards::Value::Queen, Suit::Spade}},
+            noCards, noCards, noCards, noCards, noCards, noCards
+        },
+        {1, 0, 0, 0, 0, 0, 0},
+        {
+            createFoundationPileCards(Suit::Heart, cards::Value::King),
+            createFoundationPileCards(Suit::Spade, cards::Value::Jack),
+            createFoundationPileCards(Suit::Diamond, cards::Value::King),
+            createFoundationPileCards(Suit::Club, cards::Value::Queen)
+        },
+        Cards {Card {cards::Value::King, Suit::Club}}
+    );
+}
+
+GameState createGameStateWithLastCardInStockPile() {
+    return createGameState(
+        {noCards, noCards, noCards, noCards, noCards, noCards, noCards},
+        {0, 0, 0, 0, 0, 0, 0},
+        {
+            createFoundationPileCards(Suit::Heart, cards::Value::King),
+            createFoundationPileCards(Suit::Spade, cards::Value::King),
+            createFoundationPileCards(Suit::Diamond, cards::Value::King),
+            createFoundationPileCards(Suit::Club, cards::Value::Queen)
+        },
+        Cards {Card {cards::Value::King, Suit::Club}}
+    );
+}
+
+const Move firstMoveOfLastCardsInTableauAndStockPiles {
+    MoveType::MoveTableauPileCardToFoundationPile, 0, 1};
+const Move firstMoveOfLastCardInStockPile {MoveType::SelectNextStockPileCard};
+}
+
+class HintEngineTest: public Test {
+public:
+    void expectPosition(const std::uint64_t positionHash, const GameState& gameState) {
+        EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(noCards));
+        EXPECT_CALL(solitaireMock, getPositionHash()).WillOnce(Return(positionHash));
+        EXPECT_CALL(solitaireMock, exportGameState()).WillOnce(Return(gameState));
+    }
+
+    std::optional<Move> waitForHint(const Move& expectedHint) const {
+        const auto deadline = std::chrono::steady_clock::now() + hintTimeout;
+        auto hint = hintEngine.getHint();
+
+        while (hint != expectedHint and std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+            hint = hintEngine.getHint();
+        }
+        return hint;
+    }
+
+    InSequence seq;
+    SolitaireMock solitaireMock;
+    HintEngine hintEngine;
+};
+
+TEST_F(HintEngineTest, noHintBeforeAnyPositionIsAnalyzed) {
+    EXPECT_EQ(hintEngine.getHint(), std::nullopt);
+}
+
+TEST_F(HintEngineTest, publishFirstMoveOfSolutionAsHint) {
+    expectPosition(firstPositionHash, createGameStateWithLastCardsInTableauAndStockPiles());
+    hintEngine.analyzePosition(solitaireMock);
+    EXPECT_EQ(waitForHint(firstMoveOfLastCardsInTableauAndStockPiles),
+              firstMoveOfLastCardsInTableauAndStockPiles);
+}
+
+TEST_F(HintEngineTest, doNotAnalyzePositionAgainIfItsHashIsUnchanged) {
+    expectPosition(firstPositionHash, createGameStateWithLastCardsInTableauAndStockPiles());
+    EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(noCards));
+    EXPECT_CALL(solitaireMock, getPositionHash()).WillOnce(Return(firstPositionHash));
+
+    hintEngine.analyzePosition(solitaireMock);
+    hintEngine.analyzePosition(solitaireMock);
+    EXPECT_EQ(waitForHint(firstMoveOfLastCardsInTableauAndStockPiles),
+              firstMoveOfLastCardsInTableauAndStockPiles);
+}
+
+TEST_F(HintEngineTest, hideHintWhileCardsAreInHand) {
+    expectPosition(firstPositionHash, createGameStateWithLastCardsInTableauAndStockPiles());
+    hintEngine.analyzePosition(solitaireMock);
+    ASSERT_EQ(waitForHint(firstMoveOfLastCardsInTableauAndStockPiles),
+              firstMoveOfLastCardsInTableauAndStockPiles);
+
+    EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(cardsInHand));
+    hintEngine.analyzePosition(solitaireMock);
+    EXPECT_EQ(hintEngine.getHint(), std::nullopt);
+
+    EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(noCards));
+    EXPECT_CALL(solitaireMock, getPositionHash()).WillOnce(Return(firstPositionHash));
+    hintEngine.analyzePosition(solitaireMock);
+    EXPECT_EQ(hintEngine.getHint(), firstMoveOfLastCardsInTableauAndStockPiles);
+}
+
+TEST_F(HintEngineTest, analyzeNewPositionWhenPositionHashChanges) {
+    expectPosition(firstPositionHash, createGameStateWithLastCardsInTableauAndStockPiles());
+    hintEngine.analyzePosition(solitaireMock);
+    ASSERT_EQ(waitForHint(firstMoveOfLastCardsInTableauAndStockPiles),
+              firstMoveOfLastCardsInTableauAndStockPiles);
+
+    expectPosition(secondPositionHash, createGameStateWithLastCardInStockPile());
+    hintEngine.analyzePosition(solitaireMock);
+    EXPECT_EQ(waitForHint(firstMoveOfLastCardInStockPile), firstMoveOfLastCardInStockPile);
+}
+
+class HintEngineCancellationTest: public Test {
+public:
+    void analyzePosition(HintEngine& engine, const std::uint64_t positionHash,
+                         const GameState& gameState)
+    {
+        EXPECT_CALL(solitaireMock, getCardsInHand()).WillOnce(ReturnRef(noCards));
+        EXPECT_CALL(solitaireMock, getPositionHash()).WillOnce(Return(positionHash));
+        EXPECT_CALL(solitaireMock, exportGameState()).WillOnce(Return(gameState));
+        engine.analyzePosition(solitaireMock);
+    }
+
+    const GameState hardGameState {
+        GameState::fromDeck(SeededDeckGenerator::generateDeal(hardDealsSeed, hardDealNumber))};
+    SolitaireMock solitaireMock;
+};
+
+TEST_F(HintEngineCancellationTest, publishHintOfNewPositionWithoutWaitingForLongSearch) {
+    HintEngine hintEngine {longSearchLimits};
+
+    for (std::uint64_t positionHash = 1; positionHash < 20; positionHash += 2) {
+        analyzePosition(hintEngine, positionHash, hardGameState);
+        std::this_thread::sleep_for(std::chrono::microseconds {100 * positionHash});
+        const auto startTime = std::chrono::steady_clock::now();
+        analyzePosition(hintEngine, positionHash + 1, createGameStateWithLastCardInStockPile());
+
+        while (hintEngine.getHint() != firstMoveOfLastCardInStockPile and
+               std::chrono::steady_clock::now() - startTime < hintTimeout)
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+
+        ASSERT_LT(std::chrono::steady_clock::now() - startTime, maxCancellationLatency)
+            << positionHash;
+    }
+}
+
+TEST_F(HintEngineCancellationTest, destroyEngineWithoutWaitingForLongSearch) {
+    auto hintEngine = std::make_unique<HintEngine>(longSearchLimits);
+    analyzePosition(*hintEngine, firstPositionHash, hardGameState);
+    std::this_thread::sleep_for(std::chrono::milliseconds {10});
+
+    const auto startTime = std::chrono::steady_clock::now();
+    hintEngine.reset();
+    EXPECT_LT(std::chrono::steady_clock::now() - startTime, maxCancellationLatency);
+}
+
+}
@@ -0,0 +1,197 @@
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include "GameStateUtils.h"
+#include "cards/CardSet.h"
+#include "cards/DeckGeneratorUtils.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+#include "gmock/gmock.h"
+#include "moves/MoveGenerator.h"
+#include "moves/ReversibleMoves.h"
+#include "solvers/Solver.h"
+
+using namespace testing;
+using namespace solitaire::cards;
+using namespace solitaire::moves;
+
+namespace solitaire::solvers {
+
+namespace {
+const Cards noCards;
+constexpr std::uint64_t dealsSeed {2021};
+constexpr std::uint64_t hardDealNumber {3};
+
+GameState createGameStateWithoutMovesOnTableauPiles(const Cards& stockPileCards) {
+    const std::vector<Card> topCards {
+        Card {cards::Value::Two, Suit::Heart}, Card {cards::Value::Two, Suit::Diamond},
+        Card {cards::Value::Two, Suit::Spade}, Card {cards::Value::Two, Suit::Club},
+        Card {cards::Value::Four, Suit::Heart}, Card {cards::Value::Four, Suit::Diamond},
+        Card {cards::Value::Four, Suit::Spade}
+    };
+
+    CardSet uncoveredCards {topCards.begin(), topCards.end()};
+    uncoveredCards.insert(stockPileCards.begin(), stockPileCards.end());
+
+    TableauPilesCards tableauPilesCards;
+    TableauPilesTopCoveredCardPositions topCoveredCardPositions;
+    unsigned id = 0;
+    for (const auto& card: createSortedDeck())
+        if (not uncoveredCards.contains(card)) {
+            tableauPilesCards[id].push_back(card);
+            id = (id + 1) % tableauPilesCards.size();
+        }
+    for (id = 0; id < tableauPilesCards.size(); ++id) {
+        topCoveredCardPositions[id] = tableauPilesCards[id].size();
+        tableauPilesCards[id].push_back(topCards[id]);
+    }
+
+    return createGameState(tableauPilesCards, topCoveredCardPositions,
+                           {noCards, noCards, noCards, noCards}, stockPileCards);
+}
+}
+
+class SolverTest: public Test {
+public:
+    void expectSolutionFinishesGame(GameState gameState,
+                                    const std::vector<Move>& solution) const
+    {
+        for (const auto& move: solution) {
+            MoveGenerator::Moves legalMoves;
+            const auto legalMovesCount = MoveGenerator {gameState}.generate(legalMoves);
+            ASSERT_THAT(std::vector<Move>(legalMoves.begin(),
+                                          std::next(legalMoves.begin(), legalMovesCount)),
+                        Contains(move));
+            applyMove(gameState, move);
+        }
+
+        EXPECT_THAT(gameState.foundationPilesSizes, Each(13));
+    }
+
+    Solver solver;
+};
+
+TEST_F(SolverTest, solveFinishedGame) {
+    const auto gameState = createGameState(
+        {noCards, noCards, noCards, noCards, noCards, noCards, noCards},
+        {0, 0, 0, 0, 0, 0, 0},
+        {
+            createFoundationPileCards(Suit::Heart, cards::Value::King),
+            createFoundationPileCards(Suit::Spade, cards::Value::King),
+            createFoundationPileCards(Suit::Diamond, cards::Value::King),
+            createFoundationPileCards(Suit::Club, cards::Value::King)
+        },
+        noCards
+    );
+
+    const auto result = solver.solve(gameState);
+    EXPECT_EQ(result.status, SolverStatus::Solved);
+    EXPECT_TRUE(result.moves.empty());
+    EXPECT_EQ(result.nodesCount, 0);
+}
+
+TEST_F(SolverTest, solveGameWithLastCardsInTableauAndStockPiles) {
+    const auto gameState = createGameState(
+        {
+            Cards {Card {cards::Value::King, Suit::Spade}, Card {cards::Value::Queen, Suit::Spade}},
+            noCards, noCards, noCards, noCards, noCards, noCards
+        },
+        {1, 0, 0, 0, 0, 0, 0},
+        {
+            createFoundationPileCards(Suit::Heart, cards::Value::King),
+            createFoundationPileCards(Suit::Spade, cards::Value::Jack),
+            createFoundationPileCards(Suit::Diamond, cards::Value::King),
+            createFoundationPileCards(Suit::Club, cards::Value::Queen)
+        },
+        Cards {Card {cards::Value::King, Suit::Club}}
+    );
+
+    const auto result = solver.solve(gameState);
+    ASSERT_EQ(result.status, SolverStatus::Solved);
+    expectSolutionFinishesGame(gameState, result.moves);
+}
+
+TEST_F(SolverTest, reportUnsolvableGameWithoutLegalMoves) {
+    const auto result = solver.solve(createGameStateWithoutMovesOnTableauPiles(noCards));
+    EXPECT_EQ(result.status, SolverStatus::Unsolvable);
+    EXPECT_TRUE(result.moves.empty());
+    EXPECT_EQ(result.nodesCount, 0);
+}
+
+TEST_F(SolverTest, reportUnsolvableGameWhenStockPileCardsCannotBeMoved) {
+    const auto result = solver.solve(createGameStateWithoutMovesOnTableauPiles(
+        Cards {Card {cards::Value::King, Suit::Heart}, Card {cards::Value::Queen, Suit::Club}}));
+    EXPECT_EQ(result.status, SolverStatus::Unsolvable);
+    EXPECT_TRUE(result.moves.empty());
+    EXPECT_EQ(result.nodesCount, 2);
+}
+
+TEST_F(SolverTest, stopSearchWhenNodesLimitIsReached) {
+    Solver solverWithNodesLimit {SolverLimits {100}};
+    const auto result = solverWithNodesLimit.solve(
+        SeededDeckGenerator::generateDeal(dealsSeed, hardDealNumber));
+    EXPECT_EQ(result.status, SolverStatus::NodesLimitReached);
+    EXPECT_TRUE(result.moves.empty());
+    EXPECT_EQ(result.nodesCount, 100);
+}
+
+TEST_F(SolverTest, stopSearchWhenTimeLimitIsReached) {
+    Solver solverWithTimeLimit {SolverLimits {
+        std::numeric_limits<std::uint64_t>::max(), std::chrono::milliseconds {1}}};
+    const auto result = solverWithTimeLimit.solve(
+        SeededDeckGenerator::generateDeal(dealsSeed, hardDealNumber));
+    EXPECT_EQ(result.status, SolverStatus::TimeLimitReached);
+    EXPECT_TRUE(result.moves.empty());
+}
+
+TEST_F(SolverTest, stopSearchWhenCancelled) {
+    Solver solverWithoutLimits {SolverLimits {std::numeric_limits<std::uint64_t>::max()}};
+    std::atomic<bool> isSearchFinished {false};
+    auto cancellation = std::async(std::launch::async, [&] {
+        while (not isSearchFinished)
+            solverWithoutLimits.cancel();
+    });
+
+    const auto result = solverWithoutLimits.solve(
+        SeededDeckGenerator::generateDeal(dealsSeed, hardDealNumber));
+    isSearchFinished = true;
+    cancellation.wait();
+
+    EXPECT_EQ(result.status, SolverStatus::Cancelled);
+    EXPECT_TRUE(result.moves.empty());
+}
+
+TEST_F(SolverTest, cancellationBeforeSearchStartsIsNotLost) {
+    const auto generation = solver.getGeneration();
+    solver.cancel();
+
+    const auto result = solver.solve(
+        GameState::fromDeck(SeededDeckGenerator::generateDeal(dealsSeed, hardDealNumber)),
+        generation);
+    EXPECT_EQ(result.status, SolverStatus::Cancelled);
+    EXPECT_LE(result.nodesCount, 1);
+}
+
+TEST_F(SolverTest, searchStartedAfterCancellationIsNotCancelled) {
+    solver.cancel();
+    const auto result = solver.solve(SeededDeckGenerator::generateDeal(dealsSeed, 5));
+    EXPECT_EQ(result.status, SolverStatus::Solved);
+}
+
+class SolverDealsTest: public SolverTest, public WithParamInterface<std::uint64_t> {
+};
+
+TEST_P(SolverDealsTest, solveDealAndReplaySolution) {
+    const auto deck = SeededDeckGenerator::generateDeal(dealsSeed, GetParam());
+
+    const auto result = solver.solve(deck);
+    ASSERT_EQ(result.status, SolverStatus::Solved);
+    EXPECT_GT(result.nodesCount, 0);
+    expectSolutionFinishesGame(GameState::fromDeck(deck), result.moves);
+}
+
+INSTANTIATE_TEST_SUITE_P(DealNumbers, SolverDealsTest, Values(5, 7, 13, 14, 29));
+
+}
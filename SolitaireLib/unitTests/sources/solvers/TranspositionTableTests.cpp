@@ -0,0 +1,76 @@
+#include "gmock/gmock.h"
+#include "solvers/TranspositionTable.h"
+
+using namespace testing;
+
+namespace solitaire::solvers {
+
+TEST(TranspositionTableTest, throwExceptionOnTooLargeSize) {
+    EXPECT_THROW(TranspositionTable {33}, std::runtime_error);
+}
+
+TEST(TranspositionTableTest, capacityIsPowerOfTwoNotSmallerThanBucket) {
+    EXPECT_EQ(TranspositionTable {10}.getCapacity(), 1024);
+    EXPECT_EQ(TranspositionTable {0}.getCapacity(), TranspositionTable::bucketSize);
+}
+
+class TranspositionTableWithOneBucketTest: public Test {
+public:
+    TranspositionTable transpositionTable {2};
+};
+
+TEST_F(TranspositionTableWithOneBucketTest, insertHashOnlyOnce) {
+    EXPECT_FALSE(transpositionTable.contains(0x1234));
+    EXPECT_TRUE(transpositionTable.tryInsert(0x1234));
+    EXPECT_TRUE(transpositionTable.contains(0x1234));
+    EXPECT_FALSE(transpositionTable.tryInsert(0x1234));
+}
+
+TEST_F(TranspositionTableWithOneBucketTest, insertZeroHash) {
+    EXPECT_FALSE(transpositionTable.contains(0));
+    EXPECT_TRUE(transpositionTable.tryInsert(0));
+    EXPECT_TRUE(transpositionTable.contains(0));
+    EXPECT_FALSE(transpositionTable.tryInsert(0));
+}
+
+TEST_F(TranspositionTableWithOneBucketTest, replaceHashWhenBucketIsFull) {
+    for (std::uint64_t hash = 1; hash <= TranspositionTable::bucketSize + 1; ++hash)
+        EXPECT_TRUE(transpositionTable.tryInsert(hash));
+
+    unsigned containedHashesCount = 0;
+    for (std::uint64_t hash = 1; hash <= TranspositionTable::bucketSize + 1; ++hash)
+        containedHashesCount += transpositionTable.contains(hash);
+
+    EXPECT_TRUE(transpositionTable.contains(TranspositionTable::bucketSize + 1));
+    EXPECT_EQ(containedHashesCount, TranspositionTable::bucketSize);
+}
+
+TEST_F(TranspositionTableWithOneBucketTest, clear) {
+    transpositionTable.tryInsert(0x1234);
+    transpositionTable.clear();
+
+    EXPECT_FALSE(transpositionTable.contains(0x1234));
+    EXPECT_TRUE(transpositionTable.tryInsert(0x1234));
+}
+
+TEST_F(TranspositionTableWithOneBucketTest, clearManyTimesForgetsHashesOfEveryGeneration) {
+    for (std::uint64_t hash = 1; hash <= 1000; ++hash) {
+        EXPECT_FALSE(transpositionTable.contains(hash - 1));
+        EXPECT_TRUE(transpositionTable.tryInsert(hash));
+        EXPECT_TRUE(transpositionTable.contains(hash));
+        transpositionTable.clear();
+    }
+}
+
+TEST_F(TranspositionTableWithOneBucketTest, clearForgetsHashesFromFullBucket) {
+    for (std::uint64_t hash = 1; hash <= TranspositionTable::bucketSize; ++hash)
+        transpositionTable.tryInsert(hash);
+    transpositionTable.clear();
+
+    for (std::uint64_t hash = 1; hash <= TranspositionTable::bucketSize; ++hash)
+        EXPECT_FALSE(transpositionTable.contains(hash));
+    for (std::uint64_t hash = 1; hash <= TranspositionTable::bucketSize; ++hash)
+        EXPECT_TRUE(transpositionTable.tryInsert(hash));
+}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cards/Deck.h"
+
+namespace solitaire::solverFarm {
+
+struct Options;
+
+class DealsSource {
+public:
+    virtual ~DealsSource() = default;
+
+    virtual std::uint64_t getDealsCount() const = 0;
+    virtual std::uint64_t getDealId(const std::uint64_t index) const = 0;
+    virtual cards::Deck getDeck(const std::uint64_t index) const = 0;
+};
+
+class SeededDealsSource: public DealsSource {
+public:
+    SeededDealsSource(const std::uint64_t seed, const std::uint64_t firstDealNumber,
+                      const std::uint64_t dealsCount);
+
+    std::uint64_t getDealsCount() const override;
+    std::uint64_t getDealId(const std::uint64_t index) const override;
+    cards::Deck getDeck(const std::uint64_t index) const override;
+
+private:
+    const std::uint64_t seed;
+    const std::uint64_t firstDealNumber;
+    const std::uint64_t dealsCount;
+};
+
+class DecksFileDealsSource: public DealsSource {
+public:
+    explicit DecksFileDealsSource(const std::string& filePath);
+
+    std::uint64_t getDealsCount() const override;
+    std::uint64_t getDealId(const std::uint64_t index) const override;
+    cards::Deck getDeck(const std::uint64_t index) const override;
+
+private:
+    std::vector<cards::Deck> decks;
+};
+
+std::unique_ptr<DealsSource> makeDealsSource(const Options& options);
+
+}
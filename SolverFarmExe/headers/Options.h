@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace solitaire::solverFarm {
+
+enum class OutputFormat {
+    CSV,
+    Binary
+};
+
+struct Options {
+    std::uint64_t seed {0};
+    std::uint64_t firstDealNumber {0};
+    std::uint64_t dealsCount {0};
+    std::optional<std::string> decksFilePath;
+    std::optional<std::string> outputFilePath;
+    OutputFormat outputFormat {OutputFormat::CSV};
+    unsigned threadsCount {0};
+    std::uint64_t maxNodesCount {10'000'000};
+    std::chrono::milliseconds maxTime {std::chrono::milliseconds::zero()};
+    unsigned transpositionTableSizeLog2 {22};
+};
+
+Options parseOptions(const int argc, const char* const argv[]);
+std::string getUsage();
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "Options.h"
+#include "solvers/Solver.h"
+
+namespace solitaire::solverFarm {
+
+struct DealResult {
+    std::uint64_t dealId;
+    solvers::SolverStatus status;
+    std::uint64_t nodesCount;
+    std::uint32_t solutionLength;
+    std::chrono::microseconds solvingTime;
+};
+
+class ResultsWriter {
+public:
+    static constexpr std::size_t flushThreshold {1 << 16};
+
+    ResultsWriter(std::ostream& output, const OutputFormat format);
+
+    void append(std::string& buffer, const DealResult& result) const;
+    void flush(std::string& buffer);
+
+private:
+    void appendCSV(std::string& buffer, const DealResult& result) const;
+    void appendBinary(std::string& buffer, const DealResult& result) const;
+
+    std::ostream& output;
+    const OutputFormat format;
+    std::mutex outputMutex;
+};
+
+}
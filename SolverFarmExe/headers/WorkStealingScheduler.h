@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace solitaire::solverFarm {
+
+class WorkStealingScheduler {
+public:
+    WorkStealingScheduler(const std::uint64_t itemsCount, const unsigned workersCount);
+
+    bool tryTakeItem(const unsigned workerId, std::uint64_t& item);
+
+private:
+    struct alignas(64) ItemsRange {
+        std::atomic<std::uint64_t> packedRange;
+    };
+
+    static std::uint64_t packRange(const std::uint32_t begin, const std::uint32_t end);
+    static std::uint32_t getRangeBegin(const std::uint64_t packedRange);
+    static std::uint32_t getRangeEnd(const std::uint64_t packedRange);
+
+    bool tryTakeOwnItem(const unsigned workerId, std::uint64_t& item);
+    bool tryStealItems(const unsigned workerId, std::uint64_t& item);
+
+    const unsigned workersCount;
+    std::unique_ptr<ItemsRange[]> itemsRanges;
+};
+
+}
@@ -0,0 +1,84 @@
+#include <fstream>
+#include <stdexcept>
+
+#include "DealsSource.h"
+#include "Options.h"
+#include "cards/Card.h"
+#include "cards/CardSet.h"
+#include "cards/SeededDeckGenerator.h"
+#include "cards/Suit.h"
+#include "cards/Value.h"
+
+using namespace solitaire::cards;
+
+namespace solitaire::solverFarm {
+
+namespace {
+Deck decodeDeck(const std::array<std::uint8_t, std::tuple_size_v<Deck>>& codes,
+                const std::uint64_t index)
+{
+    Deck deck;
+    for (std::size_t i = 0; i < deck.size(); ++i)
+        deck[i] = Card {static_cast<Value>(codes[i] & Card::valueMask),
+                        static_cast<Suit>(codes[i] >> Card::suitShift)};
+
+    if (CardSet {deck.begin(), deck.end()} != CardSet::allCards())
+        throw std::runtime_error {"Invalid deck in decks file at index " +
+                                  std::to_string(index)};
+    return deck;
+}
+}
+
+SeededDealsSource::SeededDealsSource(const std::uint64_t seed,
+                                     const std::uint64_t firstDealNumber,
+                                     const std::uint64_t dealsCount):
+    seed {seed},
+    firstDealNumber {firstDealNumber},
+    dealsCount {dealsCount} {
+}
+
+std::uint64_t SeededDealsSource::getDealsCount() const {
+    return dealsCount;
+}
+
+std::uint64_t SeededDealsSource::getDealId(const std::uint64_t index) const {
+    return firstDealNumber + index;
+}
+
+Deck SeededDealsSource::getDeck(const std::uint64_t index) const {
+    return SeededDeckGenerator::generateDeal(seed, getDealId(index));
+}
+
+DecksFileDealsSource::DecksFileDealsSource(const std::string& filePath) {
+    std::ifstream file {filePath, std::ios::binary};
+    if (not file)
+        throw std::runtime_error {"Cannot open decks file: " + filePath};
+
+    std::array<std::uint8_t, std::tuple_size_v<Deck>> codes;
+    while (file.read(reinterpret_cast<char*>(codes.data()), codes.size()))
+        decks.push_back(decodeDeck(codes, decks.size()));
+
+    if (file.gcount() != 0)
+        throw std::runtime_error {"Decks file size is not multiple of deck size"};
+}
+
+std::uint64_t DecksFileDealsSource::getDealsCount() const {
+    return decks.size();
+}
+
+std::uint64_t DecksFileDealsSource::getDealId(const std::uint64_t index) const {
+    return index;
+}
+
+Deck DecksFileDealsSource::getDeck(const std::uint64_t index) const {
+    return decks[index];
+}
+
+std::unique_ptr<DealsSource> makeDealsSource(const Options& options) {
+    if (options.decksFilePath)
+        return std::make_unique<DecksFileDealsSource>(*options.decksFilePath);
+    return std::make_unique<SeededDealsSource>(
+        options.seed, options.firstDealNumber, options.dealsCount);
+}
+
+}
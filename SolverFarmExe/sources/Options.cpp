@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "Options.h"
+
+namespace solitaire::solverFarm {
+
+namespace {
+constexpr std::uint64_t maxDealsCount {std::numeric_limits<std::uint32_t>::max()};
+constexpr std::uint64_t maxThreadsCount {1024};
+constexpr std::uint64_t maxTranspositionTableSizeLog2 {32};
+
+std::uint64_t parseNumber(const std::string& option, const std::string& value,
+                          const std::uint64_t maxValue =
+                              std::numeric_limits<std::uint64_t>::max())
+{
+    std::size_t parsedCharactersCount = 0;
+    try {
+        const auto number = std::stoull(value, &parsedCharactersCount);
+        if (parsedCharactersCount == value.size() and value.front() != '-' and
+            number <= maxValue)
+            return number;
+    }
+    catch (const std::logic_error&) {
+    }
+    throw std::runtime_error {"Invalid value of " + option + ": " + value};
+}
+
+OutputFormat parseOutputFormat(const std::string& value) {
+    if (value == "csv")
+        return OutputFormat::CSV;
+    if (value == "binary")
+        return OutputFormat::Binary;
+    throw std::runtime_error {"Invalid output format: " + value};
+}
+
+void throwExceptionOnInvalidOptions(const Options& options, const bool isSeedGiven) {
+    if (options.decksFilePath and (isSeedGiven or options.dealsCount > 0))
+        throw std::runtime_error {"Decks file cannot be combined with seeded deals"};
+    if (not options.decksFilePath and options.dealsCount == 0)
+        throw std::runtime_error {"Deals count or decks file is required"};
+    if (options.threadsCount == 0)
+        throw std::runtime_error {"Threads count must be positive"};
+}
+}
+
+Options parseOptions(const int argc, const char* const argv[]) {
+    Options options;
+    options.threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    bool isSeedGiven = false;
+
+    for (int i = 1; i < argc; i += 2) {
+        const std::string option = argv[i];
+        if (i + 1 == argc)
+            throw std::runtime_error {"Missing value of " + option};
+        const std::string value = argv[i + 1];
+
+        if (option == "--seed") {
+            options.seed = parseNumber(option, value);
+            isSeedGiven = true;
+        }
+        else if (option == "--first")
+            options.firstDealNumber = parseNumber(option, value);
+        else if (option == "--count")
+            options.dealsCount = parseNumber(option, value, maxDealsCount);
+        else if (option == "--decks")
+            options.decksFilePath = value;
+        else if (option == "--output")
+            options.outputFilePath = value;
+        else if (option == "--format")
+            options.outputFormat = parseOutputFormat(value);
+        else if (option == "--threads")
+            options.threadsCount = parseNumber(option, value, maxThreadsCount);
+        else if (option == "--max-nodes")
+            options.maxNodesCount = parseNumber(option, value);
+        else if (option == "--max-time-ms")
+            options.maxTime = std::chrono::milliseconds {parseNumber(option, value)};
+        else if (option == "--table-size-log2")
+            options.transpositionTableSizeLog2 =
+                parseNumber(option, value, maxTranspositionTableSizeLog2);
+        else
+            throw std::runtime_error {"Unknown option: " + option};
+    }
+
+    throwExceptionOnInvalidOptions(options, isSeedGiven);
+    return options;
+}
+
+std::string getUsage() {
+    return
+        "Usage: SolverFarm (--seed <seed> [--first <deal>] --count <count> | "
+        "--decks <file>)\n"
+        "                  [--output <file>] [--format csv|binary] [--threads <count>]\n"
+        "                  [--max-nodes <count>] [--max-time-ms <ms>] "
+        "[--table-size-log2 <bits>]\n"
+        "Decks file contains 52 card codes per deal, one byte per card.\n";
+}
+
+}
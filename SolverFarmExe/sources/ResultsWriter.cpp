@@ -0,0 +1,63 @@
+#include <cstring>
+#include <stdexcept>
+
+#include "ResultsWriter.h"
+
+namespace solitaire::solverFarm {
+
+namespace {
+template <class T>
+void appendBytes(std::string& buffer, const T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buffer.append(bytes, sizeof(T));
+}
+}
+
+ResultsWriter::ResultsWriter(std::ostream& output, const OutputFormat format):
+    output {output},
+    format {format}
+{
+    if (format == OutputFormat::CSV)
+        output << "deal,status,nodes,solution_length,time_us\n";
+}
+
+void ResultsWriter::append(std::string& buffer, const DealResult& result) const {
+    if (format == OutputFormat::CSV)
+        appendCSV(buffer, result);
+    else
+        appendBinary(buffer, result);
+}
+
+void ResultsWriter::flush(std::string& buffer) {
+    {
+        std::lock_guard<std::mutex> lock {outputMutex};
+        output.write(buffer.data(), buffer.size());
+        if (not output)
+            throw std::runtime_error {"Cannot write results"};
+    }
+    buffer.clear();
+}
+
+void ResultsWriter::appendCSV(std::string& buffer, const DealResult& result) const {
+    buffer += std::to_string(result.dealId);
+    buffer += ',';
+    buffer += to_string(result.status);
+    buffer += ',';
+    buffer += std::to_string(result.nodesCount);
+    buffer += ',';
+    buffer += std::to_string(result.solutionLength);
+    buffer += ',';
+    buffer += std::to_string(result.solvingTime.count());
+    buffer += '\n';
+}
+
+void ResultsWriter::appendBinary(std::string& buffer, const DealResult& result) const {
+    appendBytes(buffer, result.dealId);
+    appendBytes(buffer, static_cast<std::uint8_t>(result.status));
+    appendBytes(buffer, result.nodesCount);
+    appendBytes(buffer, result.solutionLength);
+    appendBytes(buffer, static_cast<std::uint64_t>(result.solvingTime.count()));
+}
+
+}
@@ -0,0 +1,81 @@
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "WorkStealingScheduler.h"
+
+namespace solitaire::solverFarm {
+
+WorkStealingScheduler::WorkStealingScheduler(const std::uint64_t itemsCount,
+                                             const unsigned workersCount):
+    workersCount {workersCount},
+    itemsRanges {std::make_unique<ItemsRange[]>(workersCount)}
+{
+    if (workersCount == 0)
+        throw std::runtime_error {"Scheduler needs at least one worker"};
+    if (itemsCount > std::numeric_limits<std::uint32_t>::max())
+        throw std::runtime_error {"Too many items to schedule: " + std::to_string(itemsCount)};
+
+    for (unsigned id = 0; id < workersCount; ++id)
+        itemsRanges[id].packedRange = packRange(
+            static_cast<std::uint32_t>(itemsCount * id / workersCount),
+            static_cast<std::uint32_t>(itemsCount * (id + 1) / workersCount));
+}
+
+bool WorkStealingScheduler::tryTakeItem(const unsigned workerId, std::uint64_t& item) {
+    return tryTakeOwnItem(workerId, item) or tryStealItems(workerId, item);
+}
+
+std::uint64_t WorkStealingScheduler::packRange(const std::uint32_t begin,
+                                               const std::uint32_t end)
+{
+    return static_cast<std::uint64_t>(begin) << 32 | end;
+}
+
+std::uint32_t WorkStealingScheduler::getRangeBegin(const std::uint64_t packedRange) {
+    return static_cast<std::uint32_t>(packedRange >> 32);
+}
+
+std::uint32_t WorkStealingScheduler::getRangeEnd(const std::uint64_t packedRange) {
+    return static_cast<std::uint32_t>(packedRange);
+}
+
+bool WorkStealingScheduler::tryTakeOwnItem(const unsigned workerId, std::uint64_t& item) {
+    auto& packedRange = itemsRanges[workerId].packedRange;
+    auto range = packedRange.load(std::memory_order_relaxed);
+
+    while (getRangeBegin(range) < getRangeEnd(range))
+        if (packedRange.compare_exchange_weak(
+                range, packRange(getRangeBegin(range) + 1, getRangeEnd(range)),
+                std::memory_order_relaxed))
+        {
+            item = getRangeBegin(range);
+            return true;
+        }
+    return false;
+}
+
+bool WorkStealingScheduler::tryStealItems(const unsigned workerId, std::uint64_t& item) {
+    for (unsigned offset = 1; offset < workersCount; ++offset) {
+        auto& victimPackedRange = itemsRanges[(workerId + offset) % workersCount].packedRange;
+        auto range = victimPackedRange.load(std::memory_order_relaxed);
+
+        while (getRangeBegin(range) < getRangeEnd(range)) {
+            const auto begin = getRangeBegin(range);
+            const auto end = getRangeEnd(range);
+            const auto stolenBegin = begin + (end - begin) / 2;
+
+            if (victimPackedRange.compare_exchange_weak(
+                    range, packRange(begin, stolenBegin), std::memory_order_relaxed))
+            {
+                itemsRanges[workerId].packedRange.store(
+                    packRange(stolenBegin + 1, end), std::memory_order_relaxed);
+                item = stolenBegin;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,91 @@
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "DealsSource.h"
+#include "Options.h"
+#include "ResultsWriter.h"
+#include "WorkStealingScheduler.h"
+#include "solvers/Solver.h"
+
+using namespace solitaire::solverFarm;
+using namespace solitaire::solvers;
+
+namespace {
+void solveDeals(const unsigned workerId, const Options& options,
+                const DealsSource& dealsSource, WorkStealingScheduler& scheduler,
+                ResultsWriter& resultsWriter)
+{
+    Solver solver {SolverLimits {options.maxNodesCount, options.maxTime,
+                                 options.transpositionTableSizeLog2}};
+    std::string buffer;
+    std::uint64_t dealIndex;
+
+    while (scheduler.tryTakeItem(workerId, dealIndex)) {
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto result = solver.solve(dealsSource.getDeck(dealIndex));
+        const auto solvingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime);
+
+        resultsWriter.append(buffer, DealResult {
+            dealsSource.getDealId(dealIndex), result.status, result.nodesCount,
+            static_cast<std::uint32_t>(result.moves.size()), solvingTime});
+        if (buffer.size() >= ResultsWriter::flushThreshold)
+            resultsWriter.flush(buffer);
+    }
+
+    resultsWriter.flush(buffer);
+}
+
+void runWorkers(const Options& options, const DealsSource& dealsSource,
+                ResultsWriter& resultsWriter)
+{
+    WorkStealingScheduler scheduler {dealsSource.getDealsCount(), options.threadsCount};
+    std::vector<std::exception_ptr> workersExceptions(options.threadsCount);
+    std::vector<std::thread> workers;
+
+    for (unsigned id = 0; id < options.threadsCount; ++id)
+        workers.emplace_back([&, id] {
+            try {
+                solveDeals(id, options, dealsSource, scheduler, resultsWriter);
+            }
+            catch (...) {
+                workersExceptions[id] = std::current_exception();
+            }
+        });
+
+    for (auto& worker: workers)
+        worker.join();
+
+    for (const auto& exception: workersExceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+}
+
+int main(int argc, char* argv[]) try {
+    const auto options = parseOptions(argc, argv);
+    const auto dealsSource = makeDealsSource(options);
+
+    std::ofstream outputFile;
+    if (options.outputFilePath) {
+        outputFile.open(*options.outputFilePath, std::ios::binary);
+        if (not outputFile)
+            throw std::runtime_error {"Cannot open output file: " + *options.outputFilePath};
+    }
+
+    ResultsWriter resultsWriter {options.outputFilePath ? outputFile : std::cout,
+                                 options.outputFormat};
+    runWorkers(options, *dealsSource, resultsWriter);
+    return 0;
+}
+catch (const std::runtime_error& e) {
+    std::cerr << e.what() << '\n' << getUsage();
+    return -1;
+}
+catch (const std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return -1;
+}
@@ -0,0 +1,116 @@
+#include <vector>
+
+#include "Options.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::solverFarm {
+
+namespace {
+Options parse(std::vector<const char*> arguments) {
+    arguments.insert(arguments.begin(), "SolverFarm");
+    return parseOptions(static_cast<int>(arguments.size()), arguments.data());
+}
+
+void expectParsingError(std::vector<const char*> arguments) {
+    EXPECT_THROW(parse(std::move(arguments)), std::runtime_error);
+}
+}
+
+TEST(OptionsTest, parseSeededDealsWithDefaults) {
+    const auto options = parse({"--seed", "7", "--count", "100"});
+
+    EXPECT_EQ(options.seed, 7);
+    EXPECT_EQ(options.firstDealNumber, 0);
+    EXPECT_EQ(options.dealsCount, 100);
+    EXPECT_EQ(options.decksFilePath, std::nullopt);
+    EXPECT_EQ(options.outputFilePath, std::nullopt);
+    EXPECT_EQ(options.outputFormat, OutputFormat::CSV);
+    EXPECT_GT(options.threadsCount, 0);
+    EXPECT_EQ(options.maxNodesCount, 10'000'000);
+    EXPECT_EQ(options.maxTime, std::chrono::milliseconds::zero());
+    EXPECT_EQ(options.transpositionTableSizeLog2, 22);
+}
+
+TEST(OptionsTest, parseAllOptions) {
+    const auto options = parse({
+        "--seed", "1", "--first", "20", "--count", "30", "--output", "results.bin",
+        "--format", "binary", "--threads", "4", "--max-nodes", "5000",
+        "--max-time-ms", "250", "--table-size-log2", "16"
+    });
+
+    EXPECT_EQ(options.seed, 1);
+    EXPECT_EQ(options.firstDealNumber, 20);
+    EXPECT_EQ(options.dealsCount, 30);
+    EXPECT_EQ(options.outputFilePath, "results.bin");
+    EXPECT_EQ(options.outputFormat, OutputFormat::Binary);
+    EXPECT_EQ(options.threadsCount, 4);
+    EXPECT_EQ(options.maxNodesCount, 5000);
+    EXPECT_EQ(options.maxTime, std::chrono::milliseconds {250});
+    EXPECT_EQ(options.transpositionTableSizeLog2, 16);
+}
+
+TEST(OptionsTest, parseDecksFile) {
+    const auto options = parse({"--decks", "decks.bin", "--format", "csv"});
+
+    EXPECT_EQ(options.decksFilePath, "decks.bin");
+    EXPECT_EQ(options.dealsCount, 0);
+    EXPECT_EQ(options.outputFormat, OutputFormat::CSV);
+}
+
+TEST(OptionsTest, parseLimitValues) {
+    const auto options = parse({
+        "--count", "4294967295", "--threads", "1024", "--table-size-log2", "32",
+        "--max-nodes", "18446744073709551615"
+    });
+
+    EXPECT_EQ(options.dealsCount, 4294967295);
+    EXPECT_EQ(options.threadsCount, 1024);
+    EXPECT_EQ(options.transpositionTableSizeLog2, 32);
+    EXPECT_EQ(options.maxNodesCount, 18446744073709551615u);
+}
+
+TEST(OptionsTest, throwExceptionOnMissingDeals) {
+    expectParsingError({});
+    expectParsingError({"--seed", "1"});
+    expectParsingError({"--count", "0"});
+}
+
+TEST(OptionsTest, throwExceptionOnDecksFileCombinedWithSeededDeals) {
+    expectParsingError({"--decks", "decks.bin", "--seed", "1"});
+    expectParsingError({"--decks", "decks.bin", "--count", "10"});
+}
+
+TEST(OptionsTest, throwExceptionOnMissingOptionValue) {
+    expectParsingError({"--count", "10", "--threads"});
+}
+
+TEST(OptionsTest, throwExceptionOnUnknownOption) {
+    expectParsingError({"--count", "10", "--verbose", "1"});
+}
+
+TEST(OptionsTest, throwExceptionOnInvalidNumber) {
+    expectParsingError({"--count", ""});
+    expectParsingError({"--count", "ten"});
+    expectParsingError({"--count", "10x"});
+    expectParsingError({"--count", "-10"});
+    expectParsingError({"--count", "10", "--max-nodes", "18446744073709551616"});
+}
+
+TEST(OptionsTest, throwExceptionOnInvalidOutputFormat) {
+    expectParsingError({"--count", "10", "--format", "json"});
+}
+
+TEST(OptionsTest, throwExceptionOnZeroThreads) {
+    expectParsingError({"--count", "10", "--threads", "0"});
+}
+
+TEST(OptionsTest, throwExceptionOnValuesAboveLimits) {
+    expectParsingError({"--count", "4294967296"});
+    expectParsingError({"--count", "10", "--threads", "1025"});
+    expectParsingError({"--count", "10", "--threads", "4294967296"});
+    expectParsingError({"--count", "10", "--table-size-log2", "33"});
+}
+
+}
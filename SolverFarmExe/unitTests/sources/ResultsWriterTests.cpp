@@ -0,0 +1,95 @@
+#include <sstream>
+
+#include "ResultsWriter.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+using namespace solitaire::solvers;
+
+namespace solitaire::solverFarm {
+
+namespace {
+const std::string csvHeader {"deal,status,nodes,solution_length,time_us\n"};
+
+const DealResult solvedDealResult {
+    0x0102030405060708, SolverStatus::Solved, 0x1112131415161718, 0x21222324,
+    std::chrono::microseconds {0x3132333435363738}
+};
+const DealResult cancelledDealResult {
+    42, SolverStatus::Cancelled, 1000, 0, std::chrono::microseconds {15}
+};
+
+const std::string solvedDealResultBytes {
+    "\x08\x07\x06\x05\x04\x03\x02\x01"
+    "\x00"
+    "\x18\x17\x16\x15\x14\x13\x12\x11"
+    "\x24\x23\x22\x21"
+    "\x38\x37\x36\x35\x34\x33\x32\x31",
+    29
+};
+const std::string cancelledDealResultBytes {
+    "\x2A\x00\x00\x00\x00\x00\x00\x00"
+    "\x04"
+    "\xE8\x03\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00"
+    "\x0F\x00\x00\x00\x00\x00\x00\x00",
+    29
+};
+}
+
+class ResultsWriterTest: public Test {
+public:
+    std::ostringstream output;
+    std::string buffer;
+};
+
+TEST_F(ResultsWriterTest, writeHeaderOfCSVFormat) {
+    ResultsWriter resultsWriter {output, OutputFormat::CSV};
+    EXPECT_EQ(output.str(), csvHeader);
+}
+
+TEST_F(ResultsWriterTest, writeNoHeaderOfBinaryFormat) {
+    ResultsWriter resultsWriter {output, OutputFormat::Binary};
+    EXPECT_TRUE(output.str().empty());
+}
+
+TEST_F(ResultsWriterTest, appendResultsInCSVFormat) {
+    ResultsWriter resultsWriter {output, OutputFormat::CSV};
+    resultsWriter.append(buffer, solvedDealResult);
+    resultsWriter.append(buffer, cancelledDealResult);
+
+    EXPECT_EQ(buffer,
+              "72623859790382856,Solved,1230066625199609624,555885348,3544952156018063160\n"
+              "42,Cancelled,1000,0,15\n");
+    EXPECT_EQ(output.str(), csvHeader);
+}
+
+TEST_F(ResultsWriterTest, appendResultsInBinaryFormat) {
+    ResultsWriter resultsWriter {output, OutputFormat::Binary};
+    resultsWriter.append(buffer, solvedDealResult);
+    resultsWriter.append(buffer, cancelledDealResult);
+
+    EXPECT_EQ(buffer, solvedDealResultBytes + cancelledDealResultBytes);
+    EXPECT_TRUE(output.str().empty());
+}
+
+TEST_F(ResultsWriterTest, flushWritesAndClearsBuffer) {
+    ResultsWriter resultsWriter {output, OutputFormat::Binary};
+    resultsWriter.append(buffer, solvedDealResult);
+    resultsWriter.flush(buffer);
+    resultsWriter.append(buffer, cancelledDealResult);
+    resultsWriter.flush(buffer);
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(output.str(), solvedDealResultBytes + cancelledDealResultBytes);
+}
+
+TEST_F(ResultsWriterTest, throwExceptionWhenOutputCannotBeWritten) {
+    ResultsWriter resultsWriter {output, OutputFormat::CSV};
+    resultsWriter.append(buffer, cancelledDealResult);
+    output.setstate(std::ios::badbit);
+
+    EXPECT_THROW(resultsWriter.flush(buffer), std::runtime_error);
+}
+
+}
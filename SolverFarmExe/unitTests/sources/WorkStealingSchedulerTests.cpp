@@ -0,0 +1,114 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingScheduler.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace solitaire::solverFarm {
+
+namespace {
+std::vector<std::uint64_t> takeAllItems(WorkStealingScheduler& scheduler,
+                                        const unsigned workerId)
+{
+    std::vector<std::uint64_t> items;
+    std::uint64_t item;
+    while (scheduler.tryTakeItem(workerId, item))
+        items.push_back(item);
+    return items;
+}
+}
+
+TEST(WorkStealingSchedulerTest, throwExceptionOnZeroWorkers) {
+    EXPECT_THROW(WorkStealingScheduler(10, 0), std::runtime_error);
+}
+
+TEST(WorkStealingSchedulerTest, throwExceptionOnTooManyItems) {
+    EXPECT_THROW(WorkStealingScheduler(std::uint64_t {1} << 32, 1), std::runtime_error);
+}
+
+TEST(WorkStealingSchedulerTest, noItemsToTake) {
+    WorkStealingScheduler scheduler {0, 2};
+    EXPECT_THAT(takeAllItems(scheduler, 0), IsEmpty());
+    EXPECT_THAT(takeAllItems(scheduler, 1), IsEmpty());
+}
+
+TEST(WorkStealingSchedulerTest, singleWorkerTakesItemsInOrder) {
+    WorkStealingScheduler scheduler {5, 1};
+    EXPECT_THAT(takeAllItems(scheduler, 0), ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(WorkStealingSchedulerTest, workerTakesOwnItemsBeforeStealing) {
+    WorkStealingScheduler scheduler {10, 2};
+    std::uint64_t item;
+
+    for (std::uint64_t expectedItem = 5; expectedItem < 10; ++expectedItem) {
+        ASSERT_TRUE(scheduler.tryTakeItem(1, item));
+        EXPECT_EQ(item, expectedItem);
+    }
+    ASSERT_TRUE(scheduler.tryTakeItem(0, item));
+    EXPECT_EQ(item, 0);
+}
+
+TEST(WorkStealingSchedulerTest, stealUpperHalfOfOtherWorkerItems) {
+    WorkStealingScheduler scheduler {10, 2};
+    EXPECT_THAT(takeAllItems(scheduler, 0), ElementsAre(0, 1, 2, 3, 4, 7, 8, 9, 6, 5));
+    EXPECT_THAT(takeAllItems(scheduler, 1), IsEmpty());
+}
+
+TEST(WorkStealingSchedulerTest, victimKeepsLowerHalfOfItemsAfterSteal) {
+    WorkStealingScheduler scheduler {8, 2};
+    std::uint64_t item;
+
+    for (unsigned i = 0; i < 4; ++i)
+        scheduler.tryTakeItem(0, item);
+    ASSERT_TRUE(scheduler.tryTakeItem(0, item));
+    EXPECT_EQ(item, 6);
+
+    EXPECT_THAT(takeAllItems(scheduler, 1), ElementsAre(4, 5, 7));
+    EXPECT_THAT(takeAllItems(scheduler, 0), IsEmpty());
+}
+
+TEST(WorkStealingSchedulerTest, moreWorkersThanItems) {
+    WorkStealingScheduler scheduler {3, 8};
+    std::vector<std::uint64_t> items;
+
+    for (unsigned workerId = 0; workerId < 8; ++workerId) {
+        const auto workerItems = takeAllItems(scheduler, workerId);
+        items.insert(items.end(), workerItems.begin(), workerItems.end());
+    }
+    EXPECT_THAT(items, UnorderedElementsAre(0, 1, 2));
+}
+
+TEST(WorkStealingSchedulerTest, concurrentWorkersTakeEveryItemExactlyOnceAndTerminate) {
+    constexpr std::uint64_t itemsCount {200'000};
+    constexpr unsigned workersCount {8};
+
+    WorkStealingScheduler scheduler {itemsCount, workersCount};
+    std::vector<std::atomic<unsigned>> takesCounts(itemsCount);
+    std::vector<std::thread> workers;
+
+    for (unsigned workerId = 0; workerId < workersCount; ++workerId)
+        workers.emplace_back([&, workerId] {
+            std::uint64_t item;
+            while (scheduler.tryTakeItem(workerId, item)) {
+                takesCounts[item].fetch_add(1, std::memory_order_relaxed);
+                if (workerId == 0)
+                    std::this_thread::yield();
+            }
+        });
+
+    for (auto& worker: workers)
+        worker.join();
+
+    for (std::uint64_t item = 0; item < itemsCount; ++item)
+        ASSERT_EQ(takesCounts[item].load(), 1) << item;
+
+    std::uint64_t item;
+    for (unsigned workerId = 0; workerId < workersCount; ++workerId)
+        EXPECT_FALSE(scheduler.tryTakeItem(workerId, item));
+}
+
+}